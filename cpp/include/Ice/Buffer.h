@@ -74,6 +74,11 @@ public:
             return !_size;
         }
 
+        bool owned() const
+        {
+            return _owned;
+        }
+
         void swap(Container&);
 
         void clear();
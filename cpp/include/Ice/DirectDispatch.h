@@ -0,0 +1,91 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_DIRECT_DISPATCH_H
+#define ICE_DIRECT_DISPATCH_H
+
+#include <Ice/Config.h>
+
+#ifdef ICE_CPP11_MAPPING
+
+#include <Ice/ProxyF.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ObjectF.h>
+#include <Ice/Current.h>
+#include <Ice/Exception.h>
+
+#include <functional>
+#include <type_traits>
+
+namespace Ice
+{
+
+class ObjectAdapterI;
+
+}
+
+namespace IceInternal
+{
+
+/// \cond INTERNAL
+
+//
+// Dispatches a synchronous twoway invocation on a collocated proxy directly
+// to the servant, the parameters are passed to the servant without being
+// marshaled. This is enabled with Ice.CollocationDirectDispatch and is only
+// used by the proxy code generated for operations that are dispatched
+// synchronously and don't send or return class instances. servant() returns
+// null if the invocation must go through the regular collocated invocation
+// path instead: proxy not collocated or not twoway, servant not registered
+// with the active servant map or as a default servant, dispatch interceptor,
+// dispatcher, observer, etc. The constructor only looks at the request
+// handler already cached by the proxy, the request handler is never created
+// here but by the regular invocation path and its retry logic. The Current
+// is only built by current() once the servant is found.
+//
+class ICE_API DirectDispatch
+{
+public:
+
+    DirectDispatch(::Ice::ObjectPrx*);
+    ~DirectDispatch();
+
+    template<typename T> ::std::shared_ptr<T> servant() const
+    {
+        return _servant ? ::std::dynamic_pointer_cast<T>(_servant) : nullptr;
+    }
+
+    const ::Ice::Current& current(const char*, ::Ice::OperationMode, const ::Ice::Context&);
+
+    //
+    // Called from a catch block to raise the exception thrown by the servant
+    // as the regular invocation path would: user exceptions not declared by
+    // the operation and local exceptions other than ObjectNotExistException,
+    // FacetNotExistException and OperationNotExistException are converted to
+    // unknown exceptions.
+    //
+    [[noreturn]] void exception(const ::std::function<void(const ::Ice::UserException&)>&);
+
+private:
+
+    DirectDispatch(const DirectDispatch&) = delete;
+    DirectDispatch& operator=(const DirectDispatch&) = delete;
+
+    void warning(const ::std::string&) const;
+
+    ::Ice::ObjectPrx* _proxy;
+    InstancePtr _instance;
+    ::std::shared_ptr<::Ice::ObjectAdapterI> _adapter;
+    ::std::shared_ptr<::Ice::Object> _servant;
+    ::Ice::Current* _current;
+    ::std::aligned_storage<sizeof(::Ice::Current), alignof(::Ice::Current)>::type _currentStorage;
+};
+
+/// \endcond
+
+}
+
+#endif
+
+#endif
@@ -7,6 +7,8 @@
 
 #include <Ice/IncomingAsyncF.h>
 #include <Ice/Incoming.h>
+#include <IceUtil/Shared.h>
+#include <IceUtil/Handle.h>
 
 #ifndef ICE_CPP11_MAPPING
 namespace Ice
@@ -40,6 +42,18 @@ public:
 namespace IceInternal
 {
 
+//
+// Holds the marshaling buffer of a request taken over with
+// IncomingAsync::retainBuffer.
+//
+class ICE_API RetainedBuffer : public IceUtil::Shared
+{
+public:
+
+    Buffer::Container b;
+};
+typedef IceUtil::Handle<RetainedBuffer> RetainedBufferPtr;
+
 // TODO: fix this warning
 #if defined(_MSC_VER) && (_MSC_VER >= 1900)
 #   pragma warning(push)
@@ -101,6 +115,17 @@ public:
 
     void kill(Incoming&);
 
+    //
+    // Takes over the marshaling buffer of the request. The in parameters
+    // given to the servant as a pair of pointers remain valid for as long
+    // as the returned buffer is alive, even after the dispatch returns.
+    // This must be called from the dispatch thread before the dispatch
+    // returns. Returns 0 if the buffer can't be taken over, for example
+    // if it's shared with other batched requests or if the request might
+    // be dispatched again by a dispatch interceptor.
+    //
+    RetainedBufferPtr retainBuffer();
+
     void completed();
 
 #ifdef ICE_CPP11_MAPPING
@@ -109,9 +134,17 @@ public:
 
 private:
 
+    friend class Incoming;
+
     void checkResponseSent();
     bool _responseSent;
 
+    //
+    // The input stream of the request, only set while the request is
+    // being dispatched.
+    //
+    Ice::InputStream* _is;
+
     //
     // We need a separate ConnectionIPtr, because IncomingBase only
     // holds a ConnectionI* for optimization.
@@ -683,6 +683,29 @@ public:
      */
     template<typename T> void read(std::pair<const T*, const T*>& v)
     {
+#if !defined(ICE_BIG_ENDIAN) && (defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64))
+        //
+        // Packed structs are read in place, like the sequences of
+        // numeric types, on platforms that support unaligned accesses.
+        //
+        if(IsPacked<T>::value)
+        {
+            const Byte* p;
+            Int sz = readAndCheckSeqSize(StreamableTraits<T>::minWireSize);
+            readBlob(p, static_cast<size_t>(sz) * sizeof(T));
+            if(sz > 0)
+            {
+                v.first = reinterpret_cast<const T*>(p);
+                v.second = v.first + sz;
+            }
+            else
+            {
+                v.first = 0;
+                v.second = 0;
+            }
+            return;
+        }
+#endif
         auto holder = new std::vector<T>;
         _deleters.push_back([holder] { delete holder; });
         read(*holder);
@@ -78,9 +78,16 @@ public:
     private:
 
         bool match(const std::string&);
+        bool doMatch(const std::string&);
 
         const std::string _attribute;
 
+        //
+        // Unique identifier of the regular expression, the results of the
+        // previous matches are memoized by each thread with this identifier.
+        //
+        const int _id;
+
 #ifdef __MINGW32__
     //
     // No regexp support with MinGW, when MinGW C++11 mode is not experimental
@@ -107,12 +114,24 @@ public:
 
     virtual IceMX::MetricsFailuresSeq getFailures() = 0;
     virtual IceMX::MetricsFailures getFailures(const std::string&) = 0;
+    virtual IceMX::MetricsHistograms getHistograms() = 0;
     virtual IceMX::MetricsMap getMetrics() const = 0;
 
     virtual MetricsMapIPtr clone() const = 0;
 
     const Ice::PropertyDict& getProperties() const;
 
+    //
+    // Adds the given lifetime to the lifetime histogram, see
+    // IceMX::MetricsHistograms for the bucket layout.
+    //
+    static void addToHistogram(Ice::LongSeq&, Ice::Long);
+
+    //
+    // Returns the lifetime histogram without its trailing empty buckets.
+    //
+    static Ice::LongSeq trimHistogram(const Ice::LongSeq&);
+
 protected:
 
     const Ice::PropertyDict _properties;
@@ -121,6 +140,7 @@ protected:
     const int _retain;
     const std::vector<RegExpPtr> _accept;
     const std::vector<RegExpPtr> _reject;
+    const bool _histogram;
 };
 
 class ICE_API MetricsMapFactory
@@ -223,6 +243,10 @@ public:
         {
             IceUtil::Mutex::Lock sync(*_map);
             _object->totalLifetime += lifetime;
+            if(_map->_histogram)
+            {
+                addToHistogram(_histogram, lifetime);
+            }
             if(--_object->current == 0)
             {
 #ifdef ICE_CPP11_MAPPING
@@ -257,6 +281,12 @@ public:
             return f;
         }
 
+        Ice::LongSeq
+        getHistogram() const
+        {
+            return trimHistogram(_histogram);
+        }
+
         IceMX::MetricsPtr
         clone() const
         {
@@ -287,6 +317,7 @@ public:
         MetricsMapTPtr _map;
         TPtr _object;
         IceMX::StringIntDict _failures;
+        Ice::LongSeq _histogram;
         std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> > _subMaps;
         typename std::list<EntryTPtr>::iterator _detachedPos;
     };
@@ -389,6 +420,23 @@ public:
         return IceMX::MetricsFailures();
     }
 
+    virtual IceMX::MetricsHistograms
+    getHistograms()
+    {
+        IceMX::MetricsHistograms histograms;
+
+        Lock sync(*this);
+        for(typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.begin(); p != _objects.end(); ++p)
+        {
+            Ice::LongSeq histogram = p->second->getHistogram();
+            if(!histogram.empty())
+            {
+                histograms.insert(std::make_pair(p->first, histogram));
+            }
+        }
+        return histograms;
+    }
+
     std::pair<MetricsMapIPtr, SubMapMember>
     createSubMap(const std::string& subMapName)
     {
@@ -435,18 +483,16 @@ public:
             }
             else
             {
-                std::ostringstream os;
                 std::vector<std::string>::const_iterator q = _groupBySeparators.begin();
                 for(std::vector<std::string>::const_iterator p = _groupByAttributes.begin();
                     p != _groupByAttributes.end(); ++p)
                 {
-                    os << helper(*p);
+                    key += helper(*p);
                     if(q != _groupBySeparators.end())
                     {
-                        os << *q++;
+                        key += *q++;
                     }
                 }
-                key = os.str();
             }
         }
         catch(const std::exception&)
@@ -598,6 +644,7 @@ public:
     IceMX::MetricsView getMetrics();
     IceMX::MetricsFailuresSeq getFailures(const std::string&);
     IceMX::MetricsFailures getFailures(const std::string&, const std::string&);
+    IceMX::MetricsHistograms getHistograms(const std::string&);
 
     std::vector<std::string> getMaps() const;
 
@@ -681,6 +728,7 @@ public:
     virtual IceMX::MetricsView getMetricsView(std::string, Ice::Long&, const ::Ice::Current&);
     virtual IceMX::MetricsFailuresSeq getMapMetricsFailures(std::string, std::string, const ::Ice::Current&);
     virtual IceMX::MetricsFailures getMetricsFailures(std::string, std::string, std::string, const ::Ice::Current&);
+    virtual IceMX::MetricsHistograms getMetricsHistograms(std::string, std::string, const ::Ice::Current&);
 #else
     virtual void enableMetricsView(const std::string&, const ::Ice::Current&);
     virtual void disableMetricsView(const std::string&, const ::Ice::Current&);
@@ -689,6 +737,8 @@ public:
                                                             const ::Ice::Current&);
     virtual IceMX::MetricsFailures getMetricsFailures(const std::string&, const std::string&, const std::string&,
                                                       const ::Ice::Current&);
+    virtual IceMX::MetricsHistograms getMetricsHistograms(const std::string&, const std::string&,
+                                                          const ::Ice::Current&);
 #endif
     std::vector<MetricsMapIPtr> getMaps(const std::string&) const;
 
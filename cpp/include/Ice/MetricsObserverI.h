@@ -7,6 +7,8 @@
 
 #include <IceUtil/StopWatch.h>
 #include <IceUtil/Atomic.h>
+#include <IceUtil/Handle.h>
+#include <IceUtil/Shared.h>
 
 #include <Ice/Instrumentation.h>
 #include <Ice/Endpoint.h>
@@ -527,14 +529,14 @@ public:
     ObserverImplPtrType
     getObserver(const MetricsHelperT<MetricsType>& helper)
     {
-        IceUtil::Mutex::Lock sync(*this);
-        if(!_metrics)
+        MapsPtr maps = getMaps();
+        if(!maps)
         {
             return ICE_NULLPTR;
         }
 
         typename ObserverImplType::EntrySeqType metricsObjects;
-        for(typename MetricsMapSeqType::const_iterator p = _maps.begin(); p != _maps.end(); ++p)
+        for(typename MetricsMapSeqType::const_iterator p = maps->maps.begin(); p != maps->maps.end(); ++p)
         {
             typename ObserverImplType::EntryPtrType entry = (*p)->getMatching(helper);
             if(entry)
@@ -566,14 +568,15 @@ public:
         {
             return getObserver(helper);
         }
-        IceUtil::Mutex::Lock sync(*this);
-        if(!_metrics)
+
+        MapsPtr maps = getMaps();
+        if(!maps)
         {
             return ICE_NULLPTR;
         }
 
         typename ObserverImplType::EntrySeqType metricsObjects;
-        for(typename MetricsMapSeqType::const_iterator p = _maps.begin(); p != _maps.end(); ++p)
+        for(typename MetricsMapSeqType::const_iterator p = maps->maps.begin(); p != maps->maps.end(); ++p)
         {
             typename ObserverImplType::EntryPtrType entry = (*p)->getMatching(helper, old->getEntry(p->get()));
             if(entry)
@@ -615,17 +618,18 @@ public:
             }
 
             std::vector<IceInternal::MetricsMapIPtr> maps = _metrics->getMaps(_name);
-            _maps.clear();
+            MapsPtr newMaps = new Maps;
             for(std::vector<IceInternal::MetricsMapIPtr>::const_iterator p = maps.begin(); p != maps.end(); ++p)
             {
 #ifdef ICE_CPP11_MAPPING
-                _maps.push_back(::std::dynamic_pointer_cast<IceInternal::MetricsMapT<MetricsType>>(*p));
+                newMaps->maps.push_back(::std::dynamic_pointer_cast<IceInternal::MetricsMapT<MetricsType>>(*p));
 #else
-                _maps.push_back(IceUtil::Handle<IceInternal::MetricsMapT<MetricsType> >::dynamicCast(*p));
+                newMaps->maps.push_back(IceUtil::Handle<IceInternal::MetricsMapT<MetricsType> >::dynamicCast(*p));
 #endif
-                assert(_maps.back());
+                assert(newMaps->maps.back());
             }
-            _enabled.exchange(_maps.empty() ? 0 : 1);
+            _maps = newMaps->maps.empty() ? MapsPtr() : newMaps;
+            _enabled.exchange(_maps ? 1 : 0);
             updater = _updater;
         }
 
@@ -645,14 +649,33 @@ public:
     {
         IceUtil::Mutex::Lock sync(*this);
         _metrics = 0;
-        _maps.clear();
+        _maps = 0;
     }
 
 private:
 
+    //
+    // The maps are replaced instead of being updated, the observers are
+    // created from the current maps without holding the factory mutex while
+    // matching the maps against the helper attributes.
+    //
+    class Maps : public IceUtil::Shared
+    {
+    public:
+
+        MetricsMapSeqType maps;
+    };
+    typedef IceUtil::Handle<Maps> MapsPtr;
+
+    MapsPtr getMaps()
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        return _metrics ? _maps : MapsPtr();
+    }
+
     IceInternal::MetricsAdminIPtr _metrics;
     const std::string _name;
-    MetricsMapSeqType _maps;
+    MapsPtr _maps;
     //
     // TODO: Replace by std::atomic<bool> when it becomes widely
     // available.
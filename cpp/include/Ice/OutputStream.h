@@ -442,6 +442,13 @@ public:
     template<typename T> void write(const T* begin, const T* end)
     {
         writeSize(static_cast<Int>(end - begin));
+#ifndef ICE_BIG_ENDIAN
+        if(IsPacked<T>::value)
+        {
+            writeBlob(reinterpret_cast<const Byte*>(begin), static_cast<size_t>(end - begin) * sizeof(T));
+            return;
+        }
+#endif
         for(const T* p = begin; p != end; ++p)
         {
             write(*p);
@@ -1125,6 +1125,7 @@ public:
     void _checkTwowayOnly(const ::std::string&) const;
 
     ::IceInternal::RequestHandlerPtr _getRequestHandler();
+    ::IceInternal::RequestHandlerPtr _getCachedRequestHandler();
     ::IceInternal::BatchRequestQueuePtr _getBatchRequestQueue();
     ::IceInternal::RequestHandlerPtr _setRequestHandler(const ::IceInternal::RequestHandlerPtr&);
     void _updateRequestHandler(const ::IceInternal::RequestHandlerPtr&, const ::IceInternal::RequestHandlerPtr&);
@@ -426,6 +426,20 @@ struct StreamableTraits< ::IceInternal::Handle<T> >
 };
 #endif
 
+/**
+ * Indicates whether the memory layout of a struct matches its encoding, in
+ * which case sequences of this struct are marshaled with a single copy on
+ * little-endian platforms. slice2cpp generates specializations for structs
+ * whose data members are all fixed-size numeric types or such structs, the
+ * value is true if the struct has no padding.
+ * \headerfile Ice/Ice.h
+ */
+template<typename T>
+struct IsPacked
+{
+    static const bool value = false;
+};
+
 //
 // StreamHelper templates used by streams to read and write data.
 //
@@ -563,11 +577,11 @@ struct StreamHelper<T, StreamHelperCategoryEnum>
 };
 
 /**
- * Helper for sequences.
+ * Marshals the elements of a sequence one at a time.
  * \headerfile Ice/Ice.h
  */
-template<typename T>
-struct StreamHelper<T, StreamHelperCategorySequence>
+template<typename T, bool packed = IsPacked<typename T::value_type>::value>
+struct StreamSequenceHelper
 {
     template<class S> static inline void
     write(S* stream, const T& v)
@@ -591,6 +605,59 @@ struct StreamHelper<T, StreamHelperCategorySequence>
     }
 };
 
+#ifndef ICE_BIG_ENDIAN
+/**
+ * Marshals a vector of packed structs with a single copy.
+ * \headerfile Ice/Ice.h
+ */
+template<typename T, typename A>
+struct StreamSequenceHelper< ::std::vector<T, A>, true>
+{
+    template<class S> static inline void
+    write(S* stream, const ::std::vector<T, A>& v)
+    {
+        stream->writeSize(static_cast<Int>(v.size()));
+        if(!v.empty())
+        {
+            stream->writeBlob(reinterpret_cast<const Byte*>(&v[0]), v.size() * sizeof(T));
+        }
+    }
+
+    template<class S> static inline void
+    read(S* stream, ::std::vector<T, A>& v)
+    {
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<T>::minWireSize);
+        ::std::vector<T, A>(static_cast<size_t>(sz)).swap(v);
+        if(sz > 0)
+        {
+            const Byte* p;
+            stream->readBlob(p, static_cast<size_t>(sz) * sizeof(T));
+            memcpy(&v[0], p, static_cast<size_t>(sz) * sizeof(T));
+        }
+    }
+};
+#endif
+
+/**
+ * Helper for sequences.
+ * \headerfile Ice/Ice.h
+ */
+template<typename T>
+struct StreamHelper<T, StreamHelperCategorySequence>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        StreamSequenceHelper<T>::write(stream, v);
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        StreamSequenceHelper<T>::read(stream, v);
+    }
+};
+
 /**
  * Helper for array custom sequence parameters.
  * \headerfile Ice/Ice.h
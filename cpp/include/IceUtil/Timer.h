@@ -82,6 +82,16 @@ public:
 
 protected:
 
+    //
+    // Construct a timer without starting its execution thread. This is used
+    // by derived classes that override run(), they start the thread with
+    // startThread() once they are constructed.
+    //
+    Timer(bool);
+
+    void startThread();
+    void startThread(int priority);
+
     virtual void run();
     virtual void runTimerTask(const TimerTaskPtr&);
 
@@ -14,12 +14,35 @@ Glacier2::Request::Request(const ObjectPrx& proxy, const std::pair<const Byte*,
                            const Current& current, bool forwardContext, const Ice::Context& sslContext,
                            const AMD_Object_ice_invokePtr& amdCB) :
     _proxy(proxy),
-    _inParams(inParams.first, inParams.second),
+    _inParams(inParams),
     _current(current),
     _forwardContext(forwardContext),
     _sslContext(sslContext),
     _amdCB(amdCB)
 {
+    //
+    // Keep the marshaling buffer of the dispatched request instead of
+    // copying the in parameters, if it can't be retained we copy them.
+    //
+    IceInternal::IncomingAsync* incoming = dynamic_cast<IceInternal::IncomingAsync*>(amdCB.get());
+    if(incoming)
+    {
+        _inBuffer = incoming->retainBuffer();
+    }
+    if(!_inBuffer)
+    {
+        _inParamsCopy.assign(inParams.first, inParams.second);
+        if(_inParamsCopy.empty())
+        {
+            _inParams.first = _inParams.second = 0;
+        }
+        else
+        {
+            _inParams.first = &_inParamsCopy[0];
+            _inParams.second = _inParams.first + _inParamsCopy.size();
+        }
+    }
+
     Context::const_iterator p = current.ctx.find("_ovrd");
     if(p != current.ctx.end())
     {
@@ -44,17 +67,6 @@ Glacier2::Request::addBatchProxy(set<Ice::ObjectPrx>& batchProxies)
 Ice::AsyncResultPtr
 Glacier2::Request::invoke(const Callback_Object_ice_invokePtr& cb)
 {
-    pair<const Byte*, const Byte*> inPair;
-    if(_inParams.size() == 0)
-    {
-        inPair.first = inPair.second = 0;
-    }
-    else
-    {
-        inPair.first = &_inParams[0];
-        inPair.second = inPair.first + _inParams.size();
-    }
-
     if(_proxy->ice_isBatchOneway() || _proxy->ice_isBatchDatagram())
     {
         ByteSeq outParams;
@@ -64,22 +76,22 @@ Glacier2::Request::invoke(const Callback_Object_ice_invokePtr& cb)
             {
                 Ice::Context ctx = _current.ctx;
                 ctx.insert(_sslContext.begin(), _sslContext.end());
-                _proxy->ice_invoke(_current.operation, _current.mode, inPair, outParams, ctx);
+                _proxy->ice_invoke(_current.operation, _current.mode, _inParams, outParams, ctx);
             }
             else
             {
-                _proxy->ice_invoke(_current.operation, _current.mode, inPair, outParams, _current.ctx);
+                _proxy->ice_invoke(_current.operation, _current.mode, _inParams, outParams, _current.ctx);
             }
         }
         else
         {
             if(_sslContext.size() > 0)
             {
-                _proxy->ice_invoke(_current.operation, _current.mode, inPair, outParams, _sslContext);
+                _proxy->ice_invoke(_current.operation, _current.mode, _inParams, outParams, _sslContext);
             }
             else
             {
-                _proxy->ice_invoke(_current.operation, _current.mode, inPair, outParams);
+                _proxy->ice_invoke(_current.operation, _current.mode, _inParams, outParams);
             }
         }
         return 0;
@@ -93,22 +105,22 @@ Glacier2::Request::invoke(const Callback_Object_ice_invokePtr& cb)
             {
                 Ice::Context ctx = _current.ctx;
                 ctx.insert(_sslContext.begin(), _sslContext.end());
-                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, inPair, ctx, cb, this);
+                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, _inParams, ctx, cb, this);
             }
             else
             {
-                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, inPair, _current.ctx, cb, this);
+                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, _inParams, _current.ctx, cb, this);
             }
         }
         else
         {
             if(_sslContext.size() > 0)
             {
-                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, inPair, _sslContext, cb, this);
+                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, _inParams, _sslContext, cb, this);
             }
             else
             {
-                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, inPair, cb, this);
+                result = _proxy->begin_ice_invoke(_current.operation, _current.mode, _inParams, cb, this);
             }
         }
 
@@ -45,7 +45,9 @@ private:
     void queued();
 
     const Ice::ObjectPrx _proxy;
-    const Ice::ByteSeq _inParams;
+    std::pair<const Ice::Byte*, const Ice::Byte*> _inParams;
+    IceInternal::RetainedBufferPtr _inBuffer;
+    Ice::ByteSeq _inParamsCopy;
     const Ice::Current _current;
     const bool _forwardContext;
     const Ice::Context _sslContext;
@@ -7,7 +7,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
-#include <IceUtil/Timer.h>
+#include <Ice/TimerWheel.h>
 #include <Ice/ACMF.h>
 #include <Ice/Connection.h>
 #include <Ice/ConnectionIF.h>
@@ -91,7 +91,7 @@ class ConnectionACMMonitor : public ACMMonitor,
 {
 public:
 
-    ConnectionACMMonitor(const FactoryACMMonitorPtr&, const IceUtil::TimerPtr&, const ACMConfig&);
+    ConnectionACMMonitor(const FactoryACMMonitorPtr&, const IceUtilInternal::WheelTimerPtr&, const ACMConfig&);
     virtual ~ConnectionACMMonitor();
 
     virtual void add(const Ice::ConnectionIPtr&);
@@ -108,7 +108,7 @@ private:
     virtual void runTimerTask();
 
     const FactoryACMMonitorPtr _parent;
-    const IceUtil::TimerPtr _timer;
+    const IceUtilInternal::WheelTimerPtr _timer;
     const ACMConfig _config;
 
     Ice::ConnectionIPtr _connection;
@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Buffer.h>
+#include <Ice/BufferPool.h>
 #include <Ice/LocalException.h>
 
 using namespace std;
@@ -83,7 +84,7 @@ IceInternal::Buffer::Container::~Container()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        BufferPool::release(_buf, _capacity);
     }
 }
 
@@ -102,7 +103,7 @@ IceInternal::Buffer::Container::clear()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        BufferPool::release(_buf, _capacity);
     }
 
     _buf = 0;
@@ -115,15 +116,15 @@ IceInternal::Buffer::Container::clear()
 void
 IceInternal::Buffer::Container::reserve(size_type n)
 {
-    size_type c = _capacity;
+    size_type c;
     if(n > _capacity)
     {
-        _capacity = std::max<size_type>(n, 2 * _capacity);
-        _capacity = std::max<size_type>(static_cast<size_type>(240), _capacity);
+        c = std::max<size_type>(n, 2 * _capacity);
+        c = std::max<size_type>(static_cast<size_type>(240), c);
     }
     else if(n < _capacity)
     {
-        _capacity = n;
+        c = n;
     }
     else
     {
@@ -131,25 +132,42 @@ IceInternal::Buffer::Container::reserve(size_type n)
     }
 
     pointer p;
-    if(_owned)
+    if(_owned && !BufferPool::pooled(_capacity) && !BufferPool::pooled(BufferPool::capacity(c)))
     {
-        p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
+        p = reinterpret_cast<pointer>(::realloc(_buf, c));
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        //
+        // Get the buffer from the pool unless it has the same size class as
+        // the current buffer.
+        //
+        c = BufferPool::capacity(c);
+        if(_owned && c == _capacity)
+        {
+            return;
+        }
+
+        p = BufferPool::allocate(c);
         if(p)
         {
-            ::memcpy(p, _buf, _size);
+            if(_size > 0)
+            {
+                ::memcpy(p, _buf, _size);
+            }
+            if(_owned && _buf)
+            {
+                BufferPool::release(_buf, _capacity);
+            }
             _owned = true;
         }
     }
 
     if(!p)
     {
-        _capacity = c; // Restore the previous capacity.
         throw std::bad_alloc();
     }
 
     _buf = p;
+    _capacity = c;
 }
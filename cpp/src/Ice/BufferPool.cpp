@@ -0,0 +1,206 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/BufferPool.h>
+#include <Ice/ThreadLocal.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/MutexPtrLock.h>
+
+#include <vector>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+const size_t minSize = 256;
+const size_t maxClasses = 17; // 256 bytes to 16MB
+
+//
+// The pool is disabled until it's configured by the first communicator.
+//
+size_t maxSize = 0;
+size_t maxBuffers = 0;
+
+IceUtil::Mutex* statsMutex = 0;
+Long deadThreadsHits = 0;
+Long deadThreadsMisses = 0;
+
+size_t
+sizeClass(size_t capacity)
+{
+    size_t i = 0;
+    for(size_t sz = minSize; sz < capacity; sz <<= 1)
+    {
+        ++i;
+    }
+    return i;
+}
+
+class ThreadCache
+{
+public:
+
+    ThreadCache() :
+        hits(0),
+        misses(0)
+    {
+    }
+
+    ~ThreadCache()
+    {
+        for(size_t i = 0; i < maxClasses; ++i)
+        {
+            for(vector<Byte*>::const_iterator p = buffers[i].begin(); p != buffers[i].end(); ++p)
+            {
+                ::free(*p);
+            }
+        }
+
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(statsMutex);
+        deadThreadsHits += hits;
+        deadThreadsMisses += misses;
+    }
+
+    vector<Byte*> buffers[maxClasses];
+    Long hits;
+    Long misses;
+};
+
+ThreadLocal<ThreadCache> threadCache;
+
+class Init
+{
+public:
+
+    Init()
+    {
+        statsMutex = new IceUtil::Mutex;
+    }
+
+    ~Init()
+    {
+        maxSize = 0;
+
+        //
+        // The caches of the threads still running are leaked, release the
+        // cache of the main thread.
+        //
+        threadCache.reset();
+        delete statsMutex;
+        statsMutex = 0;
+    }
+};
+
+Init init;
+
+}
+
+void
+IceInternal::BufferPool::configure(int size, int buffers)
+{
+    if(size < static_cast<int>(minSize) || buffers <= 0)
+    {
+        maxSize = 0;
+        return;
+    }
+
+    //
+    // The largest size class is the largest power of two not greater than
+    // the given size.
+    //
+    size_t sz = minSize;
+    for(size_t i = 1; i < maxClasses && (sz << 1) <= static_cast<size_t>(size); ++i)
+    {
+        sz <<= 1;
+    }
+    maxBuffers = static_cast<size_t>(buffers);
+    maxSize = sz;
+}
+
+size_t
+IceInternal::BufferPool::capacity(size_t n)
+{
+    if(n > maxSize)
+    {
+        return n;
+    }
+
+    size_t sz = minSize;
+    while(sz < n)
+    {
+        sz <<= 1;
+    }
+    return sz;
+}
+
+bool
+IceInternal::BufferPool::pooled(size_t capacity)
+{
+    return capacity >= minSize && capacity <= maxSize && (capacity & (capacity - 1)) == 0;
+}
+
+Byte*
+IceInternal::BufferPool::allocate(size_t capacity)
+{
+    if(pooled(capacity))
+    {
+        ThreadCache* cache = threadCache.get(true);
+        if(cache)
+        {
+            vector<Byte*>& buffers = cache->buffers[sizeClass(capacity)];
+            if(!buffers.empty())
+            {
+                ++cache->hits;
+                Byte* p = buffers.back();
+                buffers.pop_back();
+                return p;
+            }
+            ++cache->misses;
+        }
+    }
+    return reinterpret_cast<Byte*>(::malloc(capacity));
+}
+
+void
+IceInternal::BufferPool::release(Byte* p, size_t capacity)
+{
+    if(pooled(capacity))
+    {
+        //
+        // Don't create a cache, the thread might be releasing the buffers of
+        // a stream it never allocated buffers with, or be terminating.
+        //
+        ThreadCache* cache = threadCache.get(false);
+        if(cache)
+        {
+            vector<Byte*>& buffers = cache->buffers[sizeClass(capacity)];
+            if(buffers.size() < maxBuffers)
+            {
+                buffers.push_back(p);
+                return;
+            }
+        }
+    }
+    ::free(p);
+}
+
+void
+IceInternal::BufferPool::getStats(Long& h, Long& m)
+{
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(statsMutex);
+        h = deadThreadsHits;
+        m = deadThreadsMisses;
+    }
+
+    ThreadCache* cache = threadCache.get(false);
+    if(cache)
+    {
+        h += cache->hits;
+        m += cache->misses;
+    }
+}
@@ -0,0 +1,61 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// The pool of the memory buffers used by Buffer::Container. Each thread
+// keeps a small cache of released buffers for each size class (powers of
+// two from 256 bytes up to Ice.BufferPool.MaxSize), so that the streams
+// created for each invocation or dispatch reuse the buffers released by
+// the previous ones instead of allocating new buffers with malloc. Buffers
+// larger than the largest size class, or released when the cache of their
+// size class is full, are freed. The pool is configured by the first
+// communicator created in the process.
+//
+class BufferPool
+{
+public:
+
+    static void configure(int, int);
+
+    //
+    // Returns the capacity of the buffer to allocate for the given size:
+    // the size of its size class if the buffer is pooled, the given size
+    // otherwise.
+    //
+    static size_t capacity(size_t);
+
+    //
+    // Returns true if a buffer with the given capacity is pooled.
+    //
+    static bool pooled(size_t);
+
+    //
+    // Allocates a buffer with the given capacity, returns null if the
+    // allocation failed.
+    //
+    static Ice::Byte* allocate(size_t);
+
+    //
+    // Releases a buffer allocated with allocate() or with malloc.
+    //
+    static void release(Ice::Byte*, size_t);
+
+    //
+    // Returns the number of allocations of pooled buffers that reused a
+    // cached buffer (hits) and that allocated a new buffer (misses).
+    //
+    static void getStats(Ice::Long&, Ice::Long&);
+};
+
+}
+
+#endif
@@ -50,6 +50,7 @@ public:
     virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool);
 
     const ReferencePtr& getReference() const { return _reference; } // Inlined for performances.
+    const Ice::ObjectAdapterIPtr& getAdapter() const { return _adapter; } // Inlined for performances.
 
     virtual Ice::ConnectionIPtr getConnection();
     virtual Ice::ConnectionIPtr waitForConnection();
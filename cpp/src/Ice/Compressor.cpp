@@ -0,0 +1,312 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Compressor.h>
+#include <Ice/LocalException.h>
+
+#ifdef ICE_HAS_BZIP2
+#  include <bzlib.h>
+#endif
+
+#ifdef ICE_HAS_LZ4
+#  include <lz4.h>
+#endif
+
+#ifdef ICE_HAS_ZSTD
+#  include <zstd.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#ifdef ICE_HAS_BZIP2
+string
+getBZ2Error(int bzError)
+{
+    if(bzError == BZ_RUN_OK)
+    {
+        return ": BZ_RUN_OK";
+    }
+    else if(bzError == BZ_FLUSH_OK)
+    {
+        return ": BZ_FLUSH_OK";
+    }
+    else if(bzError == BZ_FINISH_OK)
+    {
+        return ": BZ_FINISH_OK";
+    }
+    else if(bzError == BZ_STREAM_END)
+    {
+        return ": BZ_STREAM_END";
+    }
+    else if(bzError == BZ_CONFIG_ERROR)
+    {
+        return ": BZ_CONFIG_ERROR";
+    }
+    else if(bzError == BZ_SEQUENCE_ERROR)
+    {
+        return ": BZ_SEQUENCE_ERROR";
+    }
+    else if(bzError == BZ_PARAM_ERROR)
+    {
+        return ": BZ_PARAM_ERROR";
+    }
+    else if(bzError == BZ_MEM_ERROR)
+    {
+        return ": BZ_MEM_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR)
+    {
+        return ": BZ_DATA_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    {
+        return ": BZ_DATA_ERROR_MAGIC";
+    }
+    else if(bzError == BZ_IO_ERROR)
+    {
+        return ": BZ_IO_ERROR";
+    }
+    else if(bzError == BZ_UNEXPECTED_EOF)
+    {
+        return ": BZ_UNEXPECTED_EOF";
+    }
+    else if(bzError == BZ_OUTBUFF_FULL)
+    {
+        return ": BZ_OUTBUFF_FULL";
+    }
+    else
+    {
+        return "";
+    }
+}
+
+class BZip2Compressor : public Compressor
+{
+public:
+
+    virtual Byte
+    status() const
+    {
+        return compressionStatusBZip2;
+    }
+
+    virtual const char*
+    name() const
+    {
+        return "bzip2";
+    }
+
+    virtual size_t
+    compressBound(size_t size) const
+    {
+        return static_cast<size_t>(static_cast<double>(size) * 1.01 + 600);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize, int level) const
+    {
+        unsigned int compressedLen = static_cast<unsigned int>(dstSize);
+        int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(dst), &compressedLen,
+                                               const_cast<char*>(reinterpret_cast<const char*>(src)),
+                                               static_cast<unsigned int>(srcSize), level, 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        }
+        return compressedLen;
+    }
+
+    virtual size_t
+    uncompress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize) const
+    {
+        unsigned int uncompressedLen = static_cast<unsigned int>(dstSize);
+        int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(dst), &uncompressedLen,
+                                                 const_cast<char*>(reinterpret_cast<const char*>(src)),
+                                                 static_cast<unsigned int>(srcSize), 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError));
+        }
+        return uncompressedLen;
+    }
+};
+BZip2Compressor bzip2Compressor;
+#endif
+
+#ifdef ICE_HAS_LZ4
+class LZ4Compressor : public Compressor
+{
+public:
+
+    virtual Byte
+    status() const
+    {
+        return compressionStatusLZ4;
+    }
+
+    virtual const char*
+    name() const
+    {
+        return "lz4";
+    }
+
+    virtual size_t
+    compressBound(size_t size) const
+    {
+        return static_cast<size_t>(LZ4_compressBound(static_cast<int>(size)));
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize, int) const
+    {
+        //
+        // The compression level doesn't apply to the LZ4 fast compressor.
+        //
+        int sz = LZ4_compress_default(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+                                      static_cast<int>(srcSize), static_cast<int>(dstSize));
+        if(sz <= 0)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_compress_default failed");
+        }
+        return static_cast<size_t>(sz);
+    }
+
+    virtual size_t
+    uncompress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize) const
+    {
+        int sz = LZ4_decompress_safe(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+                                     static_cast<int>(srcSize), static_cast<int>(dstSize));
+        if(sz < 0)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_decompress_safe failed");
+        }
+        return static_cast<size_t>(sz);
+    }
+};
+LZ4Compressor lz4Compressor;
+#endif
+
+#ifdef ICE_HAS_ZSTD
+class ZstdCompressor : public Compressor
+{
+public:
+
+    virtual Byte
+    status() const
+    {
+        return compressionStatusZstd;
+    }
+
+    virtual const char*
+    name() const
+    {
+        return "zstd";
+    }
+
+    virtual size_t
+    compressBound(size_t size) const
+    {
+        return ZSTD_compressBound(size);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize, int level) const
+    {
+        size_t sz = ZSTD_compress(dst, dstSize, src, srcSize, level);
+        if(ZSTD_isError(sz))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_compress failed: ") + ZSTD_getErrorName(sz));
+        }
+        return sz;
+    }
+
+    virtual size_t
+    uncompress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize) const
+    {
+        size_t sz = ZSTD_decompress(dst, dstSize, src, srcSize);
+        if(ZSTD_isError(sz))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_decompress failed: ") + ZSTD_getErrorName(sz));
+        }
+        return sz;
+    }
+};
+ZstdCompressor zstdCompressor;
+#endif
+
+}
+
+IceInternal::Compressor::~Compressor()
+{
+    // Out of line to avoid weak vtable
+}
+
+const Compressor*
+IceInternal::getCompressor(Byte status)
+{
+    switch(status)
+    {
+#ifdef ICE_HAS_BZIP2
+    case compressionStatusBZip2:
+    {
+        return &bzip2Compressor;
+    }
+#endif
+#ifdef ICE_HAS_LZ4
+    case compressionStatusLZ4:
+    {
+        return &lz4Compressor;
+    }
+#endif
+#ifdef ICE_HAS_ZSTD
+    case compressionStatusZstd:
+    {
+        return &zstdCompressor;
+    }
+#endif
+    default:
+    {
+        return 0;
+    }
+    }
+}
+
+const Compressor*
+IceInternal::getCompressor(const string& name)
+{
+    for(Byte status = compressionStatusBZip2; status <= compressionStatusZstd; ++status)
+    {
+        const Compressor* compressor = getCompressor(status);
+        if(compressor && name == compressor->name())
+        {
+            return compressor;
+        }
+    }
+    return 0;
+}
+
+Byte
+IceInternal::getSupportedCompressors()
+{
+    Byte mask = 0;
+    for(Byte status = compressionStatusLZ4; status <= compressionStatusZstd; ++status)
+    {
+        if(getCompressor(status))
+        {
+            mask = static_cast<Byte>(mask | compressorMask(status));
+        }
+    }
+    return mask;
+}
+
+Byte
+IceInternal::compressorMask(Byte status)
+{
+    return status >= compressionStatusLZ4 ? static_cast<Byte>(1 << (status - compressionStatusLZ4)) : 0;
+}
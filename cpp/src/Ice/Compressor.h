@@ -0,0 +1,79 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COMPRESSOR_H
+#define ICE_COMPRESSOR_H
+
+#include <Ice/Config.h>
+
+#if !defined(ICE_OS_UWP)
+#    ifndef ICE_HAS_BZIP2
+#        define ICE_HAS_BZIP2
+#    endif
+#endif
+
+namespace IceInternal
+{
+
+//
+// The compression status of the Ice protocol message header. A
+// compression status greater than compressionStatusBZip2 identifies a
+// compressor which is only used if the peer advertised it with the
+// validate connection message.
+//
+const ::Ice::Byte compressionStatusNotSupported = 0;
+const ::Ice::Byte compressionStatusNotCompressed = 1;
+const ::Ice::Byte compressionStatusBZip2 = 2;
+const ::Ice::Byte compressionStatusLZ4 = 3;
+const ::Ice::Byte compressionStatusZstd = 4;
+
+//
+// A compressor for the body of Ice protocol messages.
+//
+class ICE_API Compressor
+{
+public:
+
+    virtual ~Compressor();
+
+    //
+    // The compression status written in the header of messages
+    // compressed with this compressor and its name.
+    //
+    virtual ::Ice::Byte status() const = 0;
+    virtual const char* name() const = 0;
+
+    //
+    // Returns the maximum size of the compressed data for the given
+    // uncompressed size.
+    //
+    virtual size_t compressBound(size_t) const = 0;
+
+    //
+    // Compress or uncompress the given data into the given buffer and
+    // return the number of bytes written. A CompressionException is
+    // raised on failure.
+    //
+    virtual size_t compress(const ::Ice::Byte*, size_t, ::Ice::Byte*, size_t, int) const = 0;
+    virtual size_t uncompress(const ::Ice::Byte*, size_t, ::Ice::Byte*, size_t) const = 0;
+};
+
+//
+// Returns the compressor for the given compression status or name or
+// null if the compressor isn't supported.
+//
+ICE_API const Compressor* getCompressor(::Ice::Byte);
+ICE_API const Compressor* getCompressor(const ::std::string&);
+
+//
+// Returns the compressors supported by this build, the compressors
+// are identified by the bit (1 << (status - compressionStatusLZ4)).
+// This mask is sent with the validate connection message.
+//
+ICE_API ::Ice::Byte getSupportedCompressors();
+ICE_API ::Ice::Byte compressorMask(::Ice::Byte);
+
+}
+
+#endif
@@ -419,7 +419,10 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
     _destroyed(false),
-    _pendingConnectCount(0)
+    _pendingConnectCount(0),
+    _raceConnectors(instance->initializationData().properties->getPropertyAsIntWithDefault(
+                        "Ice.ConnectRace.Connectors", 1)),
+    _raceDelay(instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.ConnectRace.Delay", 250))
 {
 }
 
@@ -934,7 +937,10 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _race(false),
+    _raceFinished(false),
+    _attemptScheduled(false)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -945,6 +951,46 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartCompleted(const ConnectionIPtr& connection)
 {
+    if(_race)
+    {
+        vector<ConnectorInfo>::const_iterator ci = _connectors.end();
+        Ice::Instrumentation::ObserverPtr observer;
+        vector<Attempt> attempts;
+        bool cancel = false;
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            for(vector<Attempt>::iterator p = _attempts.begin(); p != _attempts.end(); ++p)
+            {
+                if(p->connection == connection)
+                {
+                    ci = p->connector;
+                    observer = p->observer;
+                    _attempts.erase(p);
+                    cancel = finishRace(attempts);
+                    break;
+                }
+            }
+        }
+
+        if(ci == _connectors.end())
+        {
+            //
+            // Another connection won the race.
+            //
+            connection->close(ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
+            return;
+        }
+
+        closeAttempts(attempts, cancel);
+        if(observer)
+        {
+            observer->detach();
+        }
+        connection->activate();
+        _factory->finishGetConnection(_connectors, *ci, connection, ICE_SHARED_FROM_THIS);
+        return;
+    }
+
     if(_observer)
     {
         _observer->detach();
@@ -955,9 +1001,30 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartComplete
 }
 
 void
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& /*connection*/,
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& connection,
                                                                                const LocalException& ex)
 {
+    if(_race)
+    {
+        Ice::Instrumentation::ObserverPtr observer;
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            vector<Attempt>::iterator p = _attempts.begin();
+            while(p != _attempts.end() && p->connection != connection)
+            {
+                ++p;
+            }
+            if(p == _attempts.end())
+            {
+                return; // The connection lost the race and was closed.
+            }
+            observer = p->observer;
+            _attempts.erase(p);
+        }
+        attemptFailed(observer, ex);
+        return;
+    }
+
     assert(_iter != _connectors.end());
     if(connectionStartFailedImpl(ex))
     {
@@ -1088,6 +1155,13 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnection()
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
+    if(_factory->_raceConnectors > 1 && _connectors.size() > 1)
+    {
+        _race = true;
+        startAttempt();
+        return;
+    }
+
     while(true)
     {
         try
@@ -1186,6 +1260,16 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::operator<(const Connect
     return this < &rhs;
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::runTimerTask()
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        _attemptScheduled = false;
+    }
+    startAttempt();
+}
+
 bool
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(const Ice::LocalException& ex)
 {
@@ -1211,6 +1295,210 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     return false;
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::startAttempt()
+{
+    vector<ConnectorInfo>::const_iterator ci;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_raceFinished || _iter == _connectors.end() ||
+           _attempts.size() >= static_cast<size_t>(_factory->_raceConnectors))
+        {
+            return;
+        }
+        ci = _iter++;
+        _attempts.push_back(Attempt(ci));
+    }
+
+    Ice::Instrumentation::ObserverPtr observer;
+    Ice::ConnectionIPtr connection;
+    try
+    {
+        const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+        if(obsv)
+        {
+            observer = obsv->getConnectionEstablishmentObserver(ci->endpoint, ci->connector->toString());
+            if(observer)
+            {
+                observer->attach();
+            }
+        }
+
+        if(_instance->traceLevels()->network >= 2)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "trying to establish " << ci->endpoint->protocol() << " connection to "
+                << ci->connector->toString();
+        }
+        connection = _factory->createConnection(ci->connector->connect(), *ci);
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        if(_instance->traceLevels()->network >= 2)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "failed to establish " << ci->endpoint->protocol() << " connection to "
+                << ci->connector->toString() << "\n" << ex;
+        }
+
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            for(vector<Attempt>::iterator p = _attempts.begin(); p != _attempts.end(); ++p)
+            {
+                if(p->connector == ci)
+                {
+                    _attempts.erase(p);
+                    break;
+                }
+            }
+        }
+        attemptFailed(observer, ex);
+        return;
+    }
+
+    bool finished = true;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        for(vector<Attempt>::iterator p = _attempts.begin(); p != _attempts.end(); ++p)
+        {
+            if(p->connector == ci)
+            {
+                p->connection = connection;
+                p->observer = observer;
+                finished = false;
+                break;
+            }
+        }
+    }
+
+    if(finished)
+    {
+        //
+        // Another connection won the race while connecting, the connection
+        // is closed once started.
+        //
+        if(observer)
+        {
+            observer->detach();
+        }
+    }
+    else
+    {
+        scheduleAttempt();
+    }
+    connection->start(ICE_SHARED_FROM_THIS);
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::scheduleAttempt()
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_raceFinished || _attemptScheduled || _iter == _connectors.end() ||
+           _attempts.size() >= static_cast<size_t>(_factory->_raceConnectors))
+        {
+            return;
+        }
+        _attemptScheduled = true;
+    }
+
+    try
+    {
+        _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(_factory->_raceDelay));
+    }
+    catch(const IceUtil::Exception&)
+    {
+        // The communicator is being destroyed, the next connector is only tried if an attempt fails.
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::attemptFailed(const Ice::Instrumentation::ObserverPtr& observer,
+                                                                       const Ice::LocalException& ex)
+{
+    if(observer)
+    {
+        observer->failed(ex.ice_id());
+        observer->detach();
+    }
+
+    bool more;
+    bool finished = false;
+    bool cancel = false;
+    vector<Attempt> attempts;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_raceFinished)
+        {
+            return;
+        }
+
+        more = _iter != _connectors.end() || !_attempts.empty();
+        if(!more || dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex))
+        {
+            cancel = finishRace(attempts);
+            finished = true;
+        }
+    }
+
+    _factory->handleConnectionException(ex, _hasMore || more);
+    if(finished)
+    {
+        closeAttempts(attempts, cancel);
+        _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+    }
+    else
+    {
+        startAttempt(); // Replace the failed attempt right away.
+    }
+}
+
+bool
+IceInternal::OutgoingConnectionFactory::ConnectCallback::finishRace(vector<Attempt>& attempts)
+{
+    //
+    // Called with _mutex locked, returns the attempts still in progress and
+    // whether or not the next attempt is scheduled.
+    //
+    _raceFinished = true;
+    attempts.swap(_attempts);
+    bool scheduled = _attemptScheduled;
+    _attemptScheduled = false;
+    return scheduled;
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::closeAttempts(const vector<Attempt>& attempts, bool cancel)
+{
+    if(cancel)
+    {
+        try
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+        }
+    }
+
+    for(vector<Attempt>::const_iterator p = attempts.begin(); p != attempts.end(); ++p)
+    {
+        if(p->observer)
+        {
+            p->observer->detach();
+        }
+
+        //
+        // Connections that are still connecting are closed when they
+        // complete or fail to start.
+        //
+        if(p->connection)
+        {
+            p->connection->close(ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
+        }
+    }
+}
+
 void
 IceInternal::IncomingConnectionFactory::activate()
 {
@@ -1696,13 +1984,15 @@ IceInternal::IncomingConnectionFactory::connectionStartFailed(const Ice::Connect
 IceInternal::IncomingConnectionFactory::IncomingConnectionFactory(const InstancePtr& instance,
                                                                   const EndpointIPtr& endpoint,
                                                                   const EndpointIPtr& publishedEndpoint,
-                                                                  const ObjectAdapterIPtr& adapter) :
+                                                                  const ObjectAdapterIPtr& adapter,
+                                                                  bool reusePort) :
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, dynamic_cast<ObjectAdapterI*>(adapter.get())->getACM())),
     _endpoint(endpoint),
     _publishedEndpoint(publishedEndpoint),
     _acceptorStarted(false),
     _acceptorStopped(false),
+    _reusePort(reusePort),
     _adapter(adapter),
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _state(StateHolding)
@@ -1931,6 +2221,15 @@ IceInternal::IncomingConnectionFactory::createAcceptor()
             out << "attempting to bind to " << _endpoint->protocol() << " socket " << _acceptor->toString();
         }
 
+        //
+        // The object adapter listens on this endpoint with multiple acceptors, the
+        // socket must be bound with SO_REUSEPORT.
+        //
+        if(_reusePort)
+        {
+            setReusePort(_acceptor->getNativeInfo()->fd(), true);
+        }
+
         _endpoint = _acceptor->listen();
         if(_instance->traceLevels()->network >= 1)
         {
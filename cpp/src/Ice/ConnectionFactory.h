@@ -7,6 +7,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionI.h>
@@ -81,8 +82,18 @@ private:
         EndpointIPtr endpoint;
     };
 
+    //
+    // Establishes a connection to one of the connectors of the endpoints.
+    // The connectors are tried one after the other unless
+    // Ice.ConnectRace.Connectors is greater than one, the connectors are
+    // then raced: a new connection attempt starts every Ice.ConnectRace.Delay
+    // milliseconds or as soon as an attempt fails, up to this number of
+    // attempts in progress. The first connection validated is used and the
+    // others are closed.
+    //
     class ConnectCallback : public Ice::ConnectionI::StartCallback,
-                            public IceInternal::EndpointI_connectors
+                            public IceInternal::EndpointI_connectors,
+                            public IceUtil::TimerTask
 #ifdef ICE_CPP11_MAPPING
                           , public std::enable_shared_from_this<ConnectCallback>
 #endif
@@ -114,10 +125,29 @@ private:
 
         bool operator<(const ConnectCallback&) const;
 
+        virtual void runTimerTask();
+
     private:
 
         bool connectionStartFailedImpl(const Ice::LocalException&);
 
+        struct Attempt
+        {
+            Attempt(std::vector<ConnectorInfo>::const_iterator c) : connector(c)
+            {
+            }
+
+            std::vector<ConnectorInfo>::const_iterator connector;
+            Ice::ConnectionIPtr connection;
+            Ice::Instrumentation::ObserverPtr observer;
+        };
+
+        void startAttempt();
+        void scheduleAttempt();
+        void attemptFailed(const Ice::Instrumentation::ObserverPtr&, const Ice::LocalException&);
+        bool finishRace(std::vector<Attempt>&);
+        void closeAttempts(const std::vector<Attempt>&, bool);
+
         const InstancePtr _instance;
         const OutgoingConnectionFactoryPtr _factory;
         const std::vector<EndpointIPtr> _endpoints;
@@ -128,6 +158,16 @@ private:
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
         std::vector<ConnectorInfo>::const_iterator _iter;
+
+        //
+        // The state of the connection attempts when racing connectors,
+        // _iter is the next connector to try.
+        //
+        bool _race;
+        IceUtil::Mutex _mutex;
+        std::vector<Attempt> _attempts;
+        bool _raceFinished;
+        bool _attemptScheduled;
     };
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
@@ -164,6 +204,8 @@ private:
     std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
 #endif
     int _pendingConnectCount;
+    const int _raceConnectors;
+    const int _raceDelay;
 };
 
 class IncomingConnectionFactory : public EventHandler,
@@ -210,7 +252,7 @@ public:
     virtual void connectionStartFailed(const Ice::ConnectionIPtr&, const Ice::LocalException&);
 
     IncomingConnectionFactory(const InstancePtr&, const EndpointIPtr&, const EndpointIPtr&,
-                              const Ice::ObjectAdapterIPtr&);
+                              const Ice::ObjectAdapterIPtr&, bool);
     void initialize();
     virtual ~IncomingConnectionFactory();
 
@@ -248,6 +290,7 @@ private:
 
     bool _acceptorStarted;
     bool _acceptorStopped;
+    const bool _reusePort;
 
     Ice::ObjectAdapterIPtr _adapter;
     const bool _warn;
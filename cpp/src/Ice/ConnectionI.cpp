@@ -23,10 +23,6 @@
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
 
-#ifdef ICE_HAS_BZIP2
-#  include <bzlib.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -41,6 +37,34 @@ namespace
 
 const ::std::string flushBatchRequests_name = "flushBatchRequests";
 
+//
+// The maximum number of queued messages handed to the transceiver with a
+// single gathered write.
+//
+const size_t maxGatheredMessages = 64;
+
+//
+// Returns the compressor configured with Ice.Compression.Compressor,
+// bzip2 is used if the compressor isn't supported by this build. The
+// instance warns about unsupported compressors on initialization.
+//
+const Compressor*
+getConfiguredCompressor(const InstancePtr& instance)
+{
+    const Compressor* compressor =
+        getCompressor(instance->initializationData().properties->getPropertyWithDefault("Ice.Compression.Compressor",
+                                                                                         "bzip2"));
+    return compressor ? compressor : getCompressor(compressionStatusBZip2);
+}
+
+size_t
+getCompressionThreshold(const InstancePtr& instance)
+{
+    Int threshold = instance->initializationData().properties->getPropertyAsIntWithDefault(
+        "Ice.Compression.Threshold", 100);
+    return threshold < 0 ? 0 : static_cast<size_t>(threshold);
+}
+
 class TimeoutCallback : public IceUtil::TimerTask
 {
 public:
@@ -333,9 +357,15 @@ Ice::ConnectionI::OutgoingMessage::canceled(bool adoptStream)
     {
         adopt(0); // Adopt the request stream
     }
-    else
+    else if(adopted)
     {
-        assert(!adopted);
+        //
+        // Compressed stream of a queued request prepared but not yet written
+        // by a gathered write.
+        //
+        delete stream;
+        stream = 0;
+        adopted = false;
     }
 }
 
@@ -765,8 +795,7 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
         //
         // Add to the async requests map.
         //
-        _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
-                                                   pair<const Int, OutgoingAsyncBasePtr>(requestId, out));
+        _asyncRequests.add(requestId, out);
     }
     return status;
 }
@@ -1206,16 +1235,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         {
             if(o->requestId)
             {
-                if(_asyncRequestsHint != _asyncRequests.end() &&
-                   _asyncRequestsHint->second == ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
-                {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                }
-                else
-                {
-                    _asyncRequests.erase(o->requestId);
-                }
+                _asyncRequests.remove(o->requestId);
             }
 
             if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
@@ -1226,9 +1246,10 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
             {
                 //
                 // If the request is being sent, don't remove it from the send streams,
-                // it will be removed once the sending is finished.
+                // it will be removed once the sending is finished. This is also the case
+                // for queued requests partially written by a gathered write.
                 //
-                if(o == _sendStreams.begin())
+                if(o == _sendStreams.begin() || (o->stream->i && o->stream->i != o->stream->b.begin()))
                 {
                     o->canceled(true); // true = adopt the stream
                 }
@@ -1248,45 +1269,20 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
 
     if(ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
     {
-        if(_asyncRequestsHint != _asyncRequests.end())
+        Int requestId = _asyncRequests.find(outAsync);
+        if(requestId != 0)
         {
-            if(_asyncRequestsHint->second == outAsync)
+            if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
             {
-                if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
-                {
-                    setState(StateClosed, ex);
-                }
-                else
-                {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                    if(outAsync->exception(ex))
-                    {
-                        outAsync->invokeExceptionAsync();
-                    }
-                }
-                return;
+                setState(StateClosed, ex);
             }
-        }
-
-        for(map<Int, OutgoingAsyncBasePtr>::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
-        {
-            if(p->second.get() == outAsync.get())
+            else
             {
-                if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
-                {
-                    setState(StateClosed, ex);
-                }
-                else
+                _asyncRequests.remove(requestId);
+                if(outAsync->exception(ex))
                 {
-                    assert(p != _asyncRequestsHint);
-                    _asyncRequests.erase(p);
-                    if(outAsync->exception(ex))
-                    {
-                        outAsync->invokeExceptionAsync();
-                    }
+                    outAsync->invokeExceptionAsync();
                 }
-                return;
             }
         }
     }
@@ -1851,16 +1847,20 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                                                          invokeNum, servantManager, adapter, outAsync,
                                                          heartbeatCallback, current.stream));
 #else
-    if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
+    //
+    // Optimization, call dispatch() directly if there's no dispatcher and
+    // the thread pool doesn't hand dispatches to work-stealing workers.
+    //
+    if(!_dispatcher && !_threadPool->hasDispatchWorkers())
     {
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
                  current.stream);
     }
     else
     {
-        _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
-                                                             invokeNum, servantManager, adapter, outAsync,
-                                                             heartbeatCallback, current.stream));
+        current.dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
+                                                        invokeNum, servantManager, adapter, outAsync,
+                                                        heartbeatCallback, current.stream));
 
     }
 #endif
@@ -2125,23 +2125,23 @@ Ice::ConnectionI::finish(bool close)
             o->completed(*_exception);
             if(o->requestId) // Make sure finished isn't called twice.
             {
-                _asyncRequests.erase(o->requestId);
+                _asyncRequests.remove(o->requestId);
             }
         }
 
         _sendStreams.clear();
     }
 
-    for(map<Int, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+    vector<OutgoingAsyncBasePtr> requests;
+    _asyncRequests.clear(requests);
+    for(vector<OutgoingAsyncBasePtr>::const_iterator q = requests.begin(); q != requests.end(); ++q)
     {
-        if(q->second->exception(*_exception))
+        if((*q)->exception(*_exception))
         {
-            q->second->invokeException();
+            (*q)->invokeException();
         }
     }
 
-    _asyncRequests.clear();
-
     //
     // Don't wait to be reaped to reclaim memory allocated by read/write streams.
     //
@@ -2272,8 +2272,11 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
     _compressionLevel(1),
+    _compressionThreshold(getCompressionThreshold(_instance)),
+    _compressor(getConfiguredCompressor(_instance)),
+    _peerCompressor(0),
+    _peerCompressors(0),
     _nextRequestId(1),
-    _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
@@ -2691,7 +2694,12 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+                //
+                // The compression status of the validate connection message
+                // advertises the compressors supported in addition to bzip2,
+                // it's zero if only bzip2 is supported.
+                //
+                _writeStream.write(_endpoint->datagram() ? static_cast<Byte>(0) : getSupportedCompressors());
                 _writeStream.write(headerSize); // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _logger, _traceLevels);
@@ -2773,7 +2781,8 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 throw ConnectionNotValidatedException(__FILE__, __LINE__);
             }
             Byte compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress); // The compressors supported by the peer in addition to bzip2.
+            _peerCompressors = static_cast<Byte>(compress & getSupportedCompressors());
             Int size;
             _readStream.read(size);
             if(size != headerSize)
@@ -2825,6 +2834,9 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     }
 
     assert(!_writeStream.b.empty() && _writeStream.i == _writeStream.b.end());
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    SocketOperation writeOp = SocketOperationNone;
+#endif
     try
     {
         while(true)
@@ -2858,62 +2870,28 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             // This can occur if parseMessage (called before
             // sendNextMessage by message()) closes the connection.
             //
+            // If the next message was already partially written by a gathered
+            // write, we still finish sending it to not leave a truncated message
+            // on the wire.
+            //
             if(_state >= StateClosingPending)
             {
-                return SocketOperationNone;
+                OutputStream* next = _sendStreams.front().stream;
+                if(_state > StateClosingPending || !next->i || next->i == next->b.begin())
+                {
+                    return SocketOperationNone;
+                }
             }
 
             //
-            // Otherwise, prepare the next message stream for writing.
+            // Otherwise, prepare the next message stream for writing if it
+            // wasn't already prepared by a previous gathered write.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
-            {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = 2;
-
-                //
-                // Do compression.
-                //
-                OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _logger, _traceLevels);
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
-            }
-            else
+            if(!message->stream->i)
             {
-#endif
-                if(message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#endif
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
+                prepareMessage(*message);
             }
-#endif
             _writeStream.swap(*message->stream);
 
             //
@@ -2926,11 +2904,27 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             assert(_writeStream.i);
             if(_writeStream.i != _writeStream.b.end())
             {
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
                 SocketOperation op = write(_writeStream);
                 if(op)
                 {
                     return op;
                 }
+#else
+                //
+                // Write the message along with the messages queued behind it. If
+                // the write blocks, the messages which were fully written are still
+                // notified before waiting for the transceiver to be ready again.
+                //
+                if(!writeOp)
+                {
+                    writeOp = writeMessages();
+                }
+                if(writeOp && _writeStream.i != _writeStream.b.end())
+                {
+                    return writeOp;
+                }
+#endif
             }
             if(_observer)
             {
@@ -2959,6 +2953,135 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message)
+{
+    assert(!message.stream->i);
+    //
+    // Only compress messages larger than the compression threshold.
+    //
+    const Compressor* compressor = 0;
+    if(message.compress && message.stream->b.size() >= _compressionThreshold)
+    {
+        compressor = getMessageCompressor();
+    }
+    if(compressor)
+    {
+        //
+        // Message compressed. Request compressed response, if any.
+        //
+        message.stream->b[9] = compressor->status();
+
+        //
+        // Do compression.
+        //
+        OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+        doCompress(compressor, *message.stream, stream);
+
+        traceSend(*message.stream, _logger, _traceLevels);
+
+        message.adopt(&stream); // Adopt the compressed stream.
+        message.stream->i = message.stream->b.begin();
+    }
+    else
+    {
+        if(message.compress)
+        {
+            //
+            // Message not compressed. Request compressed response, if any.
+            //
+            message.stream->b[9] = 1;
+        }
+
+        //
+        // No compression, just fill in the message size.
+        //
+        Int sz = static_cast<Int>(message.stream->b.size());
+        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#else
+        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#endif
+        message.stream->i = message.stream->b.begin();
+        traceSend(*message.stream, _logger, _traceLevels);
+
+    }
+}
+
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+SocketOperation
+Ice::ConnectionI::writeMessages()
+{
+    assert(!_sendStreams.empty());
+
+    //
+    // Gather the message being sent with the messages queued behind it so that
+    // they are handed to the transceiver with a single write. The queued
+    // messages are prepared here, their stream iterator is set once prepared.
+    //
+    vector<Buffer*> buffers;
+    buffers.push_back(&_writeStream);
+    if(!_endpoint->datagram() && _state < StateClosingPending)
+    {
+        deque<OutgoingMessage>::iterator p = _sendStreams.begin();
+        for(++p; p != _sendStreams.end() && buffers.size() < maxGatheredMessages; ++p)
+        {
+            if(!p->stream)
+            {
+                break;
+            }
+            if(!p->stream->i)
+            {
+                prepareMessage(*p);
+            }
+            buffers.push_back(p->stream);
+        }
+    }
+
+    if(buffers.size() == 1)
+    {
+        return write(_writeStream);
+    }
+
+    vector<Buffer::Container::iterator> start;
+    start.reserve(buffers.size());
+    for(vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        start.push_back((*p)->i);
+    }
+
+    SocketOperation op = _transceiver->writev(buffers);
+
+    //
+    // The bytes written for the current write stream are reported to the observer
+    // by finishWrite, the bytes written for the queued messages are reported here.
+    //
+    ptrdiff_t sent = buffers[0]->i - start[0];
+    ptrdiff_t total = buffers[0]->b.end() - start[0];
+    ptrdiff_t queuedSent = 0;
+    for(size_t i = 1; i < buffers.size(); ++i)
+    {
+        queuedSent += buffers[i]->i - start[i];
+        total += buffers[i]->b.end() - start[i];
+    }
+    sent += queuedSent;
+
+    if(_observer && queuedSent > 0)
+    {
+        _observer->sentBytes(static_cast<int>(queuedSent));
+    }
+
+    if(_instance->traceLevels()->network >= 3 && sent > 0)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "sent " << sent << " of " << total << " bytes in " << buffers.size() << " messages via "
+            << _endpoint->protocol() << "\n" << toString();
+    }
+    return op;
+}
+#endif
+
 AsyncStatus
 Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
@@ -2980,19 +3103,26 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
     message.stream->i = message.stream->b.begin();
     SocketOperation op;
-#ifdef ICE_HAS_BZIP2
-    if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    //
+    // Only compress messages larger than the compression threshold.
+    //
+    const Compressor* compressor = 0;
+    if(message.compress && message.stream->b.size() >= _compressionThreshold)
+    {
+        compressor = getMessageCompressor();
+    }
+    if(compressor)
     {
         //
         // Message compressed. Request compressed response, if any.
         //
-        message.stream->b[9] = 2;
+        message.stream->b[9] = compressor->status();
 
         //
         // Do compression.
         //
         OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-        doCompress(*message.stream, stream);
+        doCompress(compressor, *message.stream, stream);
         stream.i = stream.b.begin();
 
         traceSend(*message.stream, _logger, _traceLevels);
@@ -3029,7 +3159,6 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     }
     else
     {
-#endif
         if(message.compress)
         {
             //
@@ -3080,9 +3209,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
         _sendStreams.push_back(message);
         _sendStreams.back().adopt(0); // Adopt the stream.
-#ifdef ICE_HAS_BZIP2
     }
-#endif
 
     _writeStream.swap(*_sendStreams.back().stream);
     scheduleTimeout(op);
@@ -3090,88 +3217,41 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
+const Compressor*
+Ice::ConnectionI::getMessageCompressor() const
 {
-    if(bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if(bzError == BZ_FLUSH_OK)
-    {
-        return ": BZ_FLUSH_OK";
-    }
-    else if(bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if(bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if(bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if(bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if(bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if(bzError == BZ_MEM_ERROR)
-    {
-        return ": BZ_MEM_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR)
-    {
-        return ": BZ_DATA_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR_MAGIC)
-    {
-        return ": BZ_DATA_ERROR_MAGIC";
-    }
-    else if(bzError == BZ_IO_ERROR)
-    {
-        return ": BZ_IO_ERROR";
-    }
-    else if(bzError == BZ_UNEXPECTED_EOF)
-    {
-        return ": BZ_UNEXPECTED_EOF";
-    }
-    else if(bzError == BZ_OUTBUFF_FULL)
+    //
+    // Use the compressor of the messages received from the peer if it
+    // compresses its messages with a compressor other than bzip2, otherwise
+    // use the configured compressor if the peer advertised it with the
+    // validate connection message. All the peers support bzip2.
+    //
+    if(_peerCompressor)
     {
-        return ": BZ_OUTBUFF_FULL";
+        return _peerCompressor;
     }
-    else
+    else if(_compressor && (_compressor->status() == compressionStatusBZip2 ||
+                            (_peerCompressors & compressorMask(_compressor->status()))))
     {
-        return "";
+        return _compressor;
     }
+    return getCompressor(compressionStatusBZip2);
 }
 
 void
-Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed)
+Ice::ConnectionI::doCompress(const Compressor* compressor, OutputStream& uncompressed, OutputStream& compressed)
 {
     const Byte* p;
 
     //
     // Compress the message body, but not the header.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    size_t compressedLen = compressor->compressBound(uncompressedLen);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                           &compressedLen,
-                                           reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                           uncompressedLen,
-                                           _compressionLevel, 0, 0);
-    if(bzError != BZ_OK)
-    {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
-    }
+    compressedLen = compressor->compress(&uncompressed.b[0] + headerSize, uncompressedLen,
+                                         &compressed.b[0] + headerSize + sizeof(Int), compressedLen,
+                                         _compressionLevel);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
 
     //
@@ -3206,7 +3286,7 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
 }
 
 void
-Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
+Ice::ConnectionI::doUncompress(const Compressor* compressor, InputStream& compressed, InputStream& uncompressed)
 {
     Int uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
@@ -3222,21 +3302,17 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(static_cast<size_t>(uncompressedSize));
 
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressedSize - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(Int));
-    int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                             &uncompressedLen,
-                                             reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                             compressedLen,
-                                             0, 0);
-    if(bzError != BZ_OK)
+    size_t uncompressedLen = static_cast<size_t>(uncompressedSize - headerSize);
+    size_t compressedLen = compressed.b.size() - headerSize - sizeof(Int);
+    if(compressor->uncompress(&compressed.b[0] + headerSize + sizeof(Int), compressedLen,
+                              &uncompressed.b[0] + headerSize, uncompressedLen) != uncompressedLen)
     {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        throw CompressionException(__FILE__, __LINE__, string("unexpected size of uncompressed ") +
+                                   compressor->name() + " data");
     }
 
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
-#endif
 
 SocketOperation
 Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& requestId, Byte& compress,
@@ -3266,15 +3342,25 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
         stream.read(messageType);
         stream.read(compress);
 
-        if(compress == 2)
+        if(compress >= compressionStatusBZip2)
         {
-#ifdef ICE_HAS_BZIP2
+            const Compressor* compressor = getCompressor(compress);
+            if(!compressor)
+            {
+                throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
+            }
             InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
-            doUncompress(stream, ustream);
+            doUncompress(compressor, stream, ustream);
             stream.b.swap(ustream.b);
-#else
-            throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
-#endif
+
+            //
+            // If the peer compresses its messages with a compressor other than
+            // bzip2, we use this compressor as well for the messages we send.
+            //
+            if(compress > compressionStatusBZip2)
+            {
+                _peerCompressor = compressor;
+            }
         }
         stream.i = stream.b.begin() + headerSize;
 
@@ -3356,35 +3442,9 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
                 stream.read(requestId);
 
-                map<Int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.end();
-
-                if(_asyncRequestsHint != _asyncRequests.end())
-                {
-                    if(_asyncRequestsHint->first == requestId)
-                    {
-                        q = _asyncRequestsHint;
-                    }
-                }
-
-                if(q == _asyncRequests.end())
-                {
-                    q = _asyncRequests.find(requestId);
-                }
-
-                if(q != _asyncRequests.end())
+                outAsync = _asyncRequests.remove(requestId);
+                if(outAsync)
                 {
-                    outAsync = q->second;
-
-                    if(q == _asyncRequestsHint)
-                    {
-                        _asyncRequests.erase(q++);
-                        _asyncRequestsHint = q;
-                    }
-                    else
-                    {
-                        _asyncRequests.erase(q);
-                    }
-
                     stream.swap(*outAsync->getIs());
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
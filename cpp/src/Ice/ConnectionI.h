@@ -9,7 +9,7 @@
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Time.h>
 #include <IceUtil/StopWatch.h>
-#include <IceUtil/Timer.h>
+#include <Ice/TimerWheel.h>
 #include <Ice/UniquePtr.h>
 
 #include <Ice/CommunicatorF.h>
@@ -35,15 +35,11 @@
 #include <Ice/ACM.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
+#include <Ice/Compressor.h>
+#include <Ice/RequestTable.h>
 
 #include <deque>
 
-#if !defined(ICE_OS_UWP)
-#    ifndef ICE_HAS_BZIP2
-#        define ICE_HAS_BZIP2
-#    endif
-#endif
-
 namespace Ice
 {
 
@@ -292,12 +288,15 @@ private:
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     IceInternal::SocketOperation sendNextMessage(std::vector<OutgoingMessage>&);
     IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
-
-#ifdef ICE_HAS_BZIP2
-    void doCompress(Ice::OutputStream&, Ice::OutputStream&);
-    void doUncompress(Ice::InputStream&, Ice::InputStream&);
+    void prepareMessage(OutgoingMessage&);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    IceInternal::SocketOperation writeMessages();
 #endif
 
+    const IceInternal::Compressor* getMessageCompressor() const;
+    void doCompress(const IceInternal::Compressor*, Ice::OutputStream&, Ice::OutputStream&);
+    void doUncompress(const IceInternal::Compressor*, Ice::InputStream&, Ice::InputStream&);
+
     IceInternal::SocketOperation parseMessage(Ice::InputStream&, Int&, Int&, Byte&,
                                               IceInternal::ServantManagerPtr&, ObjectAdapterPtr&,
                                               IceInternal::OutgoingAsyncBasePtr&, ICE_DELEGATE(HeartbeatCallback)&, int&);
@@ -342,7 +341,7 @@ private:
     const IceInternal::TraceLevelsPtr _traceLevels;
     const IceInternal::ThreadPoolPtr _threadPool;
 
-    const IceUtil::TimerPtr _timer;
+    const IceUtilInternal::WheelTimerPtr _timer;
     const IceUtil::TimerTaskPtr _writeTimeout;
     bool _writeTimeoutScheduled;
     const IceUtil::TimerTaskPtr _readTimeout;
@@ -356,11 +355,14 @@ private:
     IceUtil::Time _acmLastActivity;
 
     const int _compressionLevel;
+    const size_t _compressionThreshold;
+    const IceInternal::Compressor* const _compressor;
+    const IceInternal::Compressor* _peerCompressor;
+    Byte _peerCompressors;
 
     Int _nextRequestId;
 
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr>::iterator _asyncRequestsHint;
+    IceInternal::RequestTable _asyncRequests;
 
     IceInternal::UniquePtr<LocalException> _exception;
 
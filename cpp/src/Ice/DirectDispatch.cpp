@@ -0,0 +1,231 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/DirectDispatch.h>
+
+#ifdef ICE_CPP11_MAPPING
+
+#include <Ice/Proxy.h>
+#include <Ice/Reference.h>
+#include <Ice/Instance.h>
+#include <Ice/ImplicitContextI.h>
+#include <Ice/CollocatedRequestHandler.h>
+#include <Ice/ObjectAdapterI.h>
+#include <Ice/ServantManager.h>
+#include <Ice/DispatchInterceptor.h>
+#include <Ice/Protocol.h>
+#include <Ice/LocalException.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Properties.h>
+#include <Ice/StringUtil.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace IceUtilInternal
+{
+
+extern bool printStackTraces;
+
+}
+
+IceInternal::DirectDispatch::DirectDispatch(ObjectPrx* proxy) :
+    _proxy(proxy),
+    _current(0)
+{
+    Reference* ref = proxy->_getReference().get();
+    if(!ref->getInstance()->collocationDirectDispatch() ||
+       ref->getMode() != Reference::ModeTwoway ||
+       ref->getInvocationTimeout() > 0 ||
+       !ref->getCollocationOptimized())
+    {
+        return;
+    }
+
+    //
+    // Only use the request handler already cached by the proxy, it's created by the regular
+    // invocation path which also takes care of retrying if it fails.
+    //
+    CollocatedRequestHandlerPtr handler =
+        dynamic_pointer_cast<CollocatedRequestHandler>(proxy->_getCachedRequestHandler());
+    if(!handler)
+    {
+        return;
+    }
+
+    ObjectPtr servant = handler->getAdapter()->getServantManager()->findServant(ref->getIdentity(), ref->getFacet());
+    if(!servant || dynamic_pointer_cast<DispatchInterceptor>(servant))
+    {
+        return; // Servant locators and dispatch interceptors are called by the regular invocation path.
+    }
+
+    try
+    {
+        //
+        // Ensures the adapter isn't deactivated until the dispatch completes.
+        //
+        handler->getAdapter()->incDirectCount();
+    }
+    catch(const ObjectAdapterDeactivatedException&)
+    {
+        return; // The regular invocation path retries or raises the exception.
+    }
+    _instance = ref->getInstance();
+    _adapter = handler->getAdapter();
+    _servant = servant;
+}
+
+IceInternal::DirectDispatch::~DirectDispatch()
+{
+    if(_current)
+    {
+        _current->~Current();
+    }
+    if(_adapter)
+    {
+        _adapter->decDirectCount();
+    }
+}
+
+const Current&
+IceInternal::DirectDispatch::current(const char* operation, OperationMode mode, const Context& context)
+{
+    assert(_servant && !_current);
+    Reference* ref = _proxy->_getReference().get();
+
+    _current = new (&_currentStorage) Current();
+    _current->adapter = _adapter;
+    _current->id = ref->getIdentity();
+    _current->facet = ref->getFacet();
+    _current->operation = operation;
+    _current->mode = mode;
+    _current->requestId = 1;
+    _current->encoding = getCompatibleEncoding(ref->getEncoding());
+
+    if(&context != &noExplicitContext)
+    {
+        _current->ctx = context;
+    }
+    else
+    {
+        const ImplicitContextIPtr& implicitContext = _instance->getImplicitContext();
+        const Context& prxContext = ref->getContext()->getValue();
+        if(implicitContext == 0)
+        {
+            _current->ctx = prxContext;
+        }
+        else
+        {
+            implicitContext->combine(prxContext, _current->ctx);
+        }
+    }
+    return *_current;
+}
+
+void
+IceInternal::DirectDispatch::exception(const function<void(const UserException&)>& userException)
+{
+    assert(_current);
+    const PropertiesPtr& properties = _instance->initializationData().properties;
+    try
+    {
+        rethrow_exception(current_exception());
+    }
+    catch(const SystemException&)
+    {
+        throw;
+    }
+    catch(RequestFailedException& ex)
+    {
+        if(ex.id.name.empty())
+        {
+            ex.id = _current->id;
+        }
+
+        if(ex.facet.empty() && !_current->facet.empty())
+        {
+            ex.facet = _current->facet;
+        }
+
+        if(ex.operation.empty() && !_current->operation.empty())
+        {
+            ex.operation = _current->operation;
+        }
+
+        if(properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) > 1)
+        {
+            ostringstream str;
+            str << ex;
+            warning(str.str());
+        }
+        throw;
+    }
+    catch(const UserException& ex)
+    {
+        if(userException)
+        {
+            userException(ex);
+        }
+        throw UnknownUserException(__FILE__, __LINE__, ex.ice_id());
+    }
+    catch(const UnknownException& ex)
+    {
+        if(properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) > 0)
+        {
+            ostringstream str;
+            str << ex;
+            warning(str.str());
+        }
+        throw;
+    }
+    catch(const Ice::Exception& ex)
+    {
+        ostringstream str;
+        str << ex;
+        if(properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) > 0)
+        {
+            warning(str.str());
+        }
+        if(IceUtilInternal::printStackTraces)
+        {
+            str << '\n' << ex.ice_stackTrace();
+        }
+        if(dynamic_cast<const LocalException*>(&ex))
+        {
+            throw UnknownLocalException(__FILE__, __LINE__, str.str());
+        }
+        throw UnknownException(__FILE__, __LINE__, str.str());
+    }
+    catch(const std::exception& ex)
+    {
+        if(properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) > 0)
+        {
+            warning(string("std::exception: ") + ex.what());
+        }
+        throw UnknownException(__FILE__, __LINE__, string("std::exception: ") + ex.what());
+    }
+    catch(...)
+    {
+        if(properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) > 0)
+        {
+            warning("unknown c++ exception");
+        }
+        throw UnknownException(__FILE__, __LINE__, "unknown c++ exception");
+    }
+}
+
+void
+IceInternal::DirectDispatch::warning(const string& msg) const
+{
+    Warning out(_instance->initializationData().logger);
+    ToStringMode toStringMode = _instance->toStringMode();
+
+    out << "dispatch exception: " << msg;
+    out << "\nidentity: " << identityToString(_current->id, toStringMode);
+    out << "\nfacet: " << escapeString(_current->facet, "", toStringMode);
+    out << "\noperation: " << _current->operation;
+}
+
+#endif
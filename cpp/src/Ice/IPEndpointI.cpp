@@ -5,6 +5,7 @@
 #include <Ice/IPEndpointI.h>
 #include <Ice/ProtocolInstance.h>
 #include <Ice/Instance.h>
+#include <Ice/Initialize.h>
 #include <Ice/LocalException.h>
 #include <Ice/PropertiesI.h>
 #include <Ice/LoggerUtil.h>
@@ -537,30 +538,101 @@ IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance, Input
 
 #ifndef ICE_OS_UWP
 
+namespace
+{
+
+class DefaultLookup : public EndpointHostResolver::Lookup
+{
+public:
+
+    virtual vector<Address>
+    lookup(const string& host, ProtocolSupport protocol, bool preferIPv6)
+    {
+        return getAddresses(host, 0, protocol, Ice::ICE_ENUM(EndpointSelectionType, Ordered), preferIPv6, true);
+    }
+};
+
+}
+
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
-    IceUtil::Thread("Ice.HostResolver"),
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
-    _destroyed(false)
+    _cacheTimeout(instance->initializationData().properties->getPropertyAsInt("Ice.HostResolver.CacheTimeout")),
+    _destroyed(false),
+    _lookup(new DefaultLookup)
+{
+}
+
+void
+IceInternal::EndpointHostResolver::start()
 {
-    updateObserver();
+    const PropertiesPtr& properties = _instance->initializationData().properties;
+    int size = properties->getPropertyAsIntWithDefault("Ice.HostResolver.Threads", 1);
+    if(size < 1)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "Ice.HostResolver.Threads < 1; Threads adjusted to 1";
+        size = 1;
+    }
+    bool hasPriority = properties->getProperty("Ice.ThreadPriority") != "";
+    int priority = properties->getPropertyAsInt("Ice.ThreadPriority");
+
+    //
+    // If a thread can't be started, the threads already started are joined
+    // when the communicator is destroyed.
+    //
+    Lock sync(*this);
+    for(int i = 0; i < size; ++i)
+    {
+        //
+        // The thread keeps the name of the single resolver thread of
+        // previous releases unless there are several threads.
+        //
+        ostringstream name;
+        name << "Ice.HostResolver";
+        if(size > 1)
+        {
+            name << '-' << i;
+        }
+
+        HelperThreadPtr thread = new HelperThread(this, name.str());
+        thread->updateObserver();
+        if(hasPriority)
+        {
+            thread->start(0, priority);
+        }
+        else
+        {
+            thread->start();
+        }
+        _threads.push_back(thread);
+    }
 }
 
 void
 IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::EndpointSelectionType selType,
                                            const IPEndpointIPtr& endpoint, const EndpointI_connectorsPtr& callback)
 {
+    ResolveEntry entry;
+    entry.port = port;
+    entry.selType = selType;
+    entry.endpoint = endpoint;
+    entry.callback = callback;
+
     //
-    // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // Try to get the addresses without DNS lookup, either because the host
+    // is a numeric address or because its addresses are cached. If this
+    // doesn't work, we queue the request and a thread will take care of
+    // getting the endpoint addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
     {
+        vector<Address> addrs;
         try
         {
-            vector<Address> addrs = getAddresses(host, port, _protocol, selType, _preferIPv6, false);
+            addrs = getAddresses(host, port, _protocol, selType, _preferIPv6, false);
             if(!addrs.empty())
             {
                 callback->connectors(endpoint->connectors(addrs, 0));
@@ -572,17 +644,13 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
             callback->exception(ex);
             return;
         }
-    }
-
-    Lock sync(*this);
-    assert(!_destroyed);
 
-    ResolveEntry entry;
-    entry.host = host;
-    entry.port = port;
-    entry.selType = selType;
-    entry.endpoint = endpoint;
-    entry.callback = callback;
+        if(getCachedAddresses(host, _protocol, addrs))
+        {
+            connectors(entry, addrs, _protocol, 0);
+            return;
+        }
+    }
 
     const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
     if(obsv)
@@ -594,7 +662,22 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
-    _queue.push_back(entry);
+    Lock sync(*this);
+    assert(!_destroyed);
+
+    map<string, vector<ResolveEntry> >::iterator p = _pending.find(host);
+    if(p != _pending.end())
+    {
+        //
+        // The host is already queued or being resolved, the request gets
+        // the result of this lookup.
+        //
+        p->second.push_back(entry);
+        return;
+    }
+
+    _pending.insert(make_pair(host, vector<ResolveEntry>(1, entry)));
+    _queue.push_back(host);
     notify();
 }
 
@@ -604,15 +687,53 @@ IceInternal::EndpointHostResolver::destroy()
     Lock sync(*this);
     assert(!_destroyed);
     _destroyed = true;
-    notify();
+    notifyAll();
+}
+
+void
+IceInternal::EndpointHostResolver::joinWithAllThreads()
+{
+    //
+    // The threads are released once joined, this breaks the cyclic
+    // dependency between the resolver and its threads.
+    //
+    vector<HelperThreadPtr> threads;
+    {
+        Lock sync(*this);
+        assert(_destroyed);
+        threads.swap(_threads);
+    }
+
+    for(vector<HelperThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::setLookup(const LookupPtr& lookup)
+{
+    Lock sync(*this);
+    _lookup = lookup;
+}
+
+void
+IceInternal::EndpointHostResolver::updateObserver()
+{
+    Lock sync(*this);
+    for(vector<HelperThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->updateObserver();
+    }
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::run(const HelperThreadPtr& thread)
 {
     while(true)
     {
-        ResolveEntry r;
+        string host;
+        LookupPtr lookup;
         ThreadObserverPtr threadObserver;
         {
             Lock sync(*this);
@@ -626,9 +747,10 @@ IceInternal::EndpointHostResolver::run()
                 break;
             }
 
-            r = _queue.front();
+            host = _queue.front();
             _queue.pop_front();
-            threadObserver = _observer.get();
+            lookup = _lookup;
+            threadObserver = thread->_observer.get();
         }
 
         if(threadObserver)
@@ -636,10 +758,13 @@ IceInternal::EndpointHostResolver::run()
             threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateIdle), ICE_ENUM(ThreadState, ThreadStateInUseForOther));
         }
 
+        NetworkProxyPtr networkProxy;
+        ProtocolSupport protocol = _protocol;
+        vector<Address> addresses;
+        IceInternal::UniquePtr<Ice::LocalException> failure;
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
-            ProtocolSupport protocol = _protocol;
+            networkProxy = _instance->networkProxy();
             if(networkProxy)
             {
                 networkProxy = networkProxy->resolveHost(_protocol);
@@ -649,61 +774,187 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            vector<Address> addresses = getAddresses(r.host, r.port, protocol, r.selType, _preferIPv6, true);
-            if(r.observer)
+            if(!getCachedAddresses(host, protocol, addresses))
             {
-                r.observer->detach();
-                r.observer = 0;
+                addresses = lookup->lookup(host, protocol, _preferIPv6);
             }
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            ICE_SET_EXCEPTION_FROM_CLONE(failure, ex.ice_clone());
+        }
 
-            r.callback->connectors(r.endpoint->connectors(addresses, networkProxy));
-
-            if(threadObserver)
+        vector<ResolveEntry> entries;
+        {
+            Lock sync(*this);
+            map<string, vector<ResolveEntry> >::iterator p = _pending.find(host);
+            assert(p != _pending.end());
+            entries.swap(p->second);
+            _pending.erase(p);
+
+            //
+            // Failed lookups are not cached, the next request for this host
+            // tries again.
+            //
+            if(!failure.get() && _cacheTimeout != 0)
             {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
-            }
+                IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+                map<string, CacheEntry>::iterator q = _cache.begin();
+                while(q != _cache.end())
+                {
+                    if(q->second.expires != IceUtil::Time() && q->second.expires <= now)
+                    {
+                        _cache.erase(q++);
+                    }
+                    else
+                    {
+                        ++q;
+                    }
+                }
 
+                CacheEntry& entry = _cache[host];
+                entry.protocol = protocol;
+                entry.addresses = addresses;
+                entry.expires = _cacheTimeout > 0 ? now + IceUtil::Time::seconds(_cacheTimeout) : IceUtil::Time();
+            }
         }
-        catch(const Ice::LocalException& ex)
+
+        for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
         {
-            if(threadObserver)
+            if(failure.get())
             {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
+                exception(*p, *failure);
             }
-            if(r.observer)
+            else
             {
-                r.observer->failed(ex.ice_id());
-                r.observer->detach();
+                connectors(*p, addresses, protocol, networkProxy);
             }
-            r.callback->exception(ex);
+        }
+
+        if(threadObserver)
+        {
+            threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
+                                         ICE_ENUM(ThreadState, ThreadStateIdle));
         }
     }
 
-    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
+    //
+    // Fail the requests of the hosts that are still queued, the lookups in
+    // progress complete in the other threads.
+    //
+    vector<ResolveEntry> entries;
     {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if(p->observer)
+        Lock sync(*this);
+        for(deque<string>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
         {
-            p->observer->failed(ex.ice_id());
-            p->observer->detach();
+            map<string, vector<ResolveEntry> >::iterator q = _pending.find(*p);
+            assert(q != _pending.end());
+            entries.insert(entries.end(), q->second.begin(), q->second.end());
+            _pending.erase(q);
         }
-        p->callback->exception(ex);
+        _queue.clear();
     }
-    _queue.clear();
 
-    if(_observer)
+    for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
     {
-        _observer.detach();
+        exception(*p, Ice::CommunicatorDestroyedException(__FILE__, __LINE__));
+    }
+
+    if(thread->_observer)
+    {
+        thread->_observer.detach();
     }
 }
 
-void
-IceInternal::EndpointHostResolver::updateObserver()
+bool
+IceInternal::EndpointHostResolver::getCachedAddresses(const string& host, ProtocolSupport protocol,
+                                                      vector<Address>& addresses)
 {
+    if(_cacheTimeout == 0)
+    {
+        return false;
+    }
+
     Lock sync(*this);
-    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+    map<string, CacheEntry>::iterator p = _cache.find(host);
+    if(p == _cache.end() || p->second.protocol != protocol)
+    {
+        return false;
+    }
+
+    if(p->second.expires != IceUtil::Time() && p->second.expires <= IceUtil::Time::now(IceUtil::Time::Monotonic))
+    {
+        _cache.erase(p);
+        return false;
+    }
+
+    addresses = p->second.addresses;
+    return true;
+}
+
+void
+IceInternal::EndpointHostResolver::connectors(const ResolveEntry& r, const vector<Address>& addrs,
+                                              ProtocolSupport protocol, const NetworkProxyPtr& networkProxy)
+{
+    vector<ConnectorPtr> connectors;
+    try
+    {
+        //
+        // The addresses are looked up or cached without port, they are
+        // shared by all the endpoints with this host.
+        //
+        vector<Address> addresses = addrs;
+        for(vector<Address>::iterator p = addresses.begin(); p != addresses.end(); ++p)
+        {
+            setPort(*p, r.port);
+        }
+        sortAddresses(addresses, protocol, r.selType, _preferIPv6);
+        connectors = r.endpoint->connectors(addresses, networkProxy);
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        exception(r, ex);
+        return;
+    }
+
+    if(r.observer)
+    {
+        r.observer->detach();
+    }
+    r.callback->connectors(connectors);
+}
+
+void
+IceInternal::EndpointHostResolver::exception(const ResolveEntry& r, const Ice::LocalException& ex)
+{
+    if(r.observer)
+    {
+        r.observer->failed(ex.ice_id());
+        r.observer->detach();
+    }
+    r.callback->exception(ex);
+}
+
+IceInternal::EndpointHostResolver::HelperThread::HelperThread(const EndpointHostResolverPtr& resolver,
+                                                              const string& name) :
+    IceUtil::Thread(name),
+    _resolver(resolver)
+{
+}
+
+void
+IceInternal::EndpointHostResolver::HelperThread::run()
+{
+    _resolver->run(this);
+}
+
+void
+IceInternal::EndpointHostResolver::HelperThread::updateObserver()
+{
+    //
+    // Called with the resolver mutex locked.
+    //
+    const CommunicatorObserverPtr& obsv = _resolver->_instance->initializationData().observer;
     if(obsv)
     {
         _observer.attach(obsv->getThreadObserver("Communicator",
@@ -713,6 +964,12 @@ IceInternal::EndpointHostResolver::updateObserver()
     }
 }
 
+void
+IceInternal::setHostLookup(const CommunicatorPtr& communicator, const EndpointHostResolver::LookupPtr& lookup)
+{
+    getInstance(communicator)->endpointHostResolver()->setLookup(lookup);
+}
+
 #else
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
@@ -743,11 +1000,6 @@ IceInternal::EndpointHostResolver::destroy()
 {
 }
 
-void
-IceInternal::EndpointHostResolver::run()
-{
-}
-
 void
 IceInternal::EndpointHostResolver::updateObserver()
 {
@@ -14,9 +14,11 @@
 #include <Ice/Network.h>
 #include <Ice/ProtocolInstanceF.h>
 #include <Ice/ObserverHelper.h>
+#include <Ice/CommunicatorF.h>
 
 #ifndef ICE_OS_UWP
 #   include <deque>
+#   include <map>
 #endif
 
 namespace IceInternal
@@ -105,7 +107,13 @@ private:
 };
 
 #ifndef ICE_OS_UWP
-class ICE_API EndpointHostResolver : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+//
+// Resolves the host of IP endpoints with the Ice.HostResolver.Threads
+// threads. Concurrent requests for the same host share a single lookup and,
+// if Ice.HostResolver.CacheTimeout is set, the addresses of a host are
+// cached for this number of seconds and shared by all the endpoints.
+//
+class ICE_API EndpointHostResolver : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 #else
 class ICE_API EndpointHostResolver : public IceUtil::Shared
 #endif
@@ -117,16 +125,32 @@ public:
     void resolve(const std::string&, int, Ice::EndpointSelectionType, const IPEndpointIPtr&,
                  const EndpointI_connectorsPtr&);
     void destroy();
-
-    virtual void run();
     void updateObserver();
 
+#ifndef ICE_OS_UWP
+    //
+    // Performs the blocking lookup of a host, the addresses are returned
+    // without port. The default lookup uses getaddrinfo, tests install a
+    // stub with setLookup.
+    //
+    class ICE_API Lookup : public IceUtil::Shared
+    {
+    public:
+
+        virtual std::vector<Address> lookup(const std::string&, ProtocolSupport, bool) = 0;
+    };
+    typedef IceUtil::Handle<Lookup> LookupPtr;
+
+    void start();
+    void joinWithAllThreads();
+    void setLookup(const LookupPtr&);
+#endif
+
 private:
 
 #ifndef ICE_OS_UWP
     struct ResolveEntry
     {
-        std::string host;
         int port;
         Ice::EndpointSelectionType selType;
         IPEndpointIPtr endpoint;
@@ -134,17 +158,64 @@ private:
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    struct CacheEntry
+    {
+        ProtocolSupport protocol;
+        std::vector<Address> addresses;
+        IceUtil::Time expires; // Zero if the entry never expires.
+    };
+
+    class HelperThread : public IceUtil::Thread
+    {
+    public:
+
+        HelperThread(const EndpointHostResolverPtr&, const std::string&);
+        virtual void run();
+
+        void updateObserver();
+
+    private:
+
+        EndpointHostResolverPtr _resolver;
+        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+
+        friend class EndpointHostResolver;
+    };
+    typedef IceUtil::Handle<HelperThread> HelperThreadPtr;
+    friend class HelperThread;
+
+    void run(const HelperThreadPtr&);
+    bool getCachedAddresses(const std::string&, ProtocolSupport, std::vector<Address>&);
+    void connectors(const ResolveEntry&, const std::vector<Address>&, ProtocolSupport, const NetworkProxyPtr&);
+    void exception(const ResolveEntry&, const Ice::LocalException&);
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const int _cacheTimeout;
     bool _destroyed;
-    std::deque<ResolveEntry> _queue;
-    ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    LookupPtr _lookup;
+    std::vector<HelperThreadPtr> _threads;
+
+    //
+    // The hosts waiting for a lookup and the requests of each host being
+    // resolved, requests for a host already in the map wait for its lookup.
+    //
+    std::deque<std::string> _queue;
+    std::map<std::string, std::vector<ResolveEntry> > _pending;
+    std::map<std::string, CacheEntry> _cache;
 #else
     const InstancePtr _instance;
 #endif
 };
 
+#ifndef ICE_OS_UWP
+//
+// Replace the host lookup of the communicator's resolver, used by tests.
+//
+ICE_API void setHostLookup(const Ice::CommunicatorPtr&, const EndpointHostResolver::LookupPtr&);
+#endif
+
 #ifndef ICE_CPP11_MAPPING
 inline bool operator==(const IPEndpointI& l, const IPEndpointI& r)
 {
@@ -738,6 +738,10 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         {
             response(false);
         }
+        else
+        {
+            _inAsync->_is = 0;
+        }
     }
     catch(const std::exception& ex)
     {
@@ -61,6 +61,11 @@ Init init;
 IceInternal::IncomingAsync::IncomingAsync(Incoming& in) :
     IncomingBase(in),
     _responseSent(false),
+    //
+    // The buffer can't be taken over if a dispatch interceptor already
+    // called startOver, the request might be dispatched again.
+    //
+    _is(in._inParamPos ? 0 : in._is),
     _responseHandlerCopy(ICE_GET_SHARED_FROM_THIS(_responseHandler))
 {
 #ifndef ICE_CPP11_MAPPING
@@ -128,10 +133,31 @@ IceInternal::IncomingAsync::ice_exception()
 void
 IceInternal::IncomingAsync::kill(Incoming& in)
 {
+    _is = 0;
     checkResponseSent();
     in._observer.adopt(_observer); // Give back the observer to incoming.
 }
 
+RetainedBufferPtr
+IceInternal::IncomingAsync::retainBuffer()
+{
+    //
+    // The buffer is only taken over if the request is the last one in the
+    // stream (batch requests share the stream) and if the stream owns its
+    // memory (it doesn't for collocated requests).
+    //
+    if(!_is || !_interceptorCBs.empty() || _is->i != _is->b.end() || !_is->b.owned())
+    {
+        return 0;
+    }
+
+    RetainedBufferPtr buffer = new RetainedBuffer();
+    buffer->b.swap(_is->b);
+    _is->i = _is->b.begin();
+    _is = 0;
+    return buffer;
+}
+
 void
 IceInternal::IncomingAsync::completed()
 {
@@ -39,6 +39,9 @@
 #include <Ice/ObserverHelper.h>
 #include <Ice/Functional.h>
 #include <Ice/ConsoleUtil.h>
+#include <Ice/BufferPool.h>
+#include <Ice/Compressor.h>
+#include <Ice/TimerWheel.h>
 
 #include <IceUtil/DisableWarnings.h>
 #include <IceUtil/FileUtil.h>
@@ -191,17 +194,18 @@ private:
 //
 // Timer specialization which supports the thread observer
 //
-class Timer : public IceUtil::Timer
+class Timer : public IceUtilInternal::WheelTimer
 {
 public:
 
-    Timer(int priority) :
-        IceUtil::Timer(priority),
+    Timer(const IceUtil::Time& tick, int priority) :
+        IceUtilInternal::WheelTimer(tick, priority),
         _hasObserver(0)
     {
     }
 
-    Timer() :
+    Timer(const IceUtil::Time& tick) :
+        IceUtilInternal::WheelTimer(tick),
         _hasObserver(0)
     {
     }
@@ -496,7 +500,7 @@ IceInternal::Instance::retryQueue()
     return _retryQueue;
 }
 
-IceUtil::TimerPtr
+IceUtilInternal::WheelTimerPtr
 IceInternal::Instance::timer()
 {
     Lock sync(*this);
@@ -951,6 +955,7 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _collectObjects(false),
     _toStringMode(ICE_ENUM(ToStringMode, Unicode)),
     _acceptClassCycles(false),
+    _collocationDirectDispatch(false),
     _implicitContext(0),
     _stringConverter(Ice::getProcessStringConverter()),
     _wstringConverter(Ice::getProcessWstringConverter()),
@@ -1011,6 +1016,9 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
                 }
 #endif
 
+                BufferPool::configure(_initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.MaxSize", 32768),
+                                      _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.MaxBuffers", 4));
+
 #ifndef _WIN32
                 string newUser = _initData.properties->getProperty("Ice.ChangeUser");
                 if(!newUser.empty())
@@ -1212,6 +1220,15 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             }
         }
 
+        {
+            string compressor = _initData.properties->getPropertyWithDefault("Ice.Compression.Compressor", "bzip2");
+            if(!getCompressor(compressor))
+            {
+                Warning out(_initData.logger);
+                out << "unsupported compressor `" << compressor << "' for Ice.Compression.Compressor, using bzip2";
+            }
+        }
+
         const_cast<bool&>(_collectObjects) = _initData.properties->getPropertyAsInt("Ice.CollectObjects") > 0;
 
         string toStringModeStr = _initData.properties->getPropertyWithDefault("Ice.ToStringMode", "Unicode");
@@ -1453,6 +1470,15 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
         _initData.observer->setObserverUpdater(ICE_MAKE_SHARED(ObserverUpdaterI, this));
     }
 
+    //
+    // Collocated invocations are only dispatched directly to the servant if
+    // there's no observer, dispatcher or protocol tracing, these rely on the
+    // regular collocated invocation path.
+    //
+    const_cast<bool&>(_collocationDirectDispatch) =
+        _initData.properties->getPropertyAsInt("Ice.CollocationDirectDispatch") > 0 &&
+        !_initData.observer && !_initData.dispatcher && _traceLevels->protocol < 1;
+
     //
     // Create threads.
     //
@@ -1460,13 +1486,19 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     {
         bool hasPriority = _initData.properties->getProperty("Ice.ThreadPriority") != "";
         int priority = _initData.properties->getPropertyAsInt("Ice.ThreadPriority");
+
+        //
+        // With Ice.TimerTick, the timer keeps its tasks in a timing wheel with
+        // this tick, see IceUtilInternal::WheelTimer.
+        //
+        IceUtil::Time tick = IceUtil::Time::milliSeconds(_initData.properties->getPropertyAsInt("Ice.TimerTick"));
         if(hasPriority)
         {
-            _timer = new Timer(priority);
+            _timer = new Timer(tick, priority);
         }
         else
         {
-            _timer = new Timer;
+            _timer = new Timer(tick);
         }
     }
     catch(const IceUtil::Exception& ex)
@@ -1480,16 +1512,7 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     {
         _endpointHostResolver = new EndpointHostResolver(this);
 #ifndef ICE_OS_UWP
-        bool hasPriority = _initData.properties->getProperty("Ice.ThreadPriority") != "";
-        int priority = _initData.properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
-        {
-            _endpointHostResolver->start(0, priority);
-        }
-        else
-        {
-            _endpointHostResolver->start();
-        }
+        _endpointHostResolver->start();
 #endif
     }
     catch(const IceUtil::Exception& ex)
@@ -1686,7 +1709,7 @@ IceInternal::Instance::destroy()
 #ifndef ICE_OS_UWP
     if(_endpointHostResolver)
     {
-        _endpointHostResolver->getThreadControl().join();
+        _endpointHostResolver->joinWithAllThreads();
     }
 #endif
 
@@ -1716,6 +1739,23 @@ IceInternal::Instance::destroy()
         _endpointFactoryManager->destroy();
     }
 
+    if(_traceLevels->bufferPool >= 1)
+    {
+        //
+        // The threads of the thread pools are joined, their buffer pool
+        // statistics are included.
+        //
+        Long hits;
+        Long misses;
+        BufferPool::getStats(hits, misses);
+        Trace out(_initData.logger, _traceLevels->bufferPoolCat);
+        out << "buffer pool statistics:\nhits = " << hits << "\nmisses = " << misses;
+        if(hits + misses > 0)
+        {
+            out << "\nhit rate = " << (hits * 100) / (hits + misses) << "%";
+        }
+    }
+
     if(_initData.properties->getPropertyAsInt("Ice.Warn.UnusedProperties") > 0)
     {
         set<string> unusedProperties = static_cast<PropertiesI*>(_initData.properties.get())->getUnusedProperties();
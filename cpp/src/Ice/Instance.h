@@ -9,7 +9,7 @@
 #include <IceUtil/Shared.h>
 #include <IceUtil/Mutex.h>
 #include <IceUtil/RecMutex.h>
-#include <IceUtil/Timer.h>
+#include <Ice/TimerWheel.h>
 #include <Ice/StringConverter.h>
 #include <Ice/InstanceF.h>
 #include <Ice/CommunicatorF.h>
@@ -97,7 +97,7 @@ public:
     ThreadPoolPtr serverThreadPool();
     EndpointHostResolverPtr endpointHostResolver();
     RetryQueuePtr retryQueue();
-    IceUtil::TimerPtr timer();
+    IceUtilInternal::WheelTimerPtr timer();
     EndpointFactoryManagerPtr endpointFactoryManager() const;
     DynamicLibraryListPtr dynamicLibraryList() const;
     Ice::PluginManagerPtr pluginManager() const;
@@ -107,6 +107,7 @@ public:
     bool collectObjects() const { return _collectObjects; }
     Ice::ToStringMode toStringMode() const { return _toStringMode; }
     bool acceptClassCycles() const { return _acceptClassCycles; }
+    bool collocationDirectDispatch() const { return _collocationDirectDispatch; }
     const ACMConfig& clientACM() const;
     const ACMConfig& serverACM() const;
 
@@ -177,6 +178,7 @@ private:
     const bool _collectObjects; // Immutable, not reset by destroy().
     const Ice::ToStringMode _toStringMode; // Immutable, not reset by destroy()
     const bool _acceptClassCycles; // Immutable, not reset by destroy()
+    const bool _collocationDirectDispatch; // Immutable, not reset by destroy()
     ACMConfig _clientACM;
     ACMConfig _serverACM;
     RouterManagerPtr _routerManager;
@@ -267,13 +267,15 @@ public:
     {
         if(_id.empty())
         {
-            ostringstream os;
             if(!_current.id.category.empty())
             {
-                os << _current.id.category << '/';
+                _id += _current.id.category;
+                _id += '/';
             }
-            os << _current.id.name << " [" << _current.operation << ']';
-            _id = os.str();
+            _id += _current.id.name;
+            _id += " [";
+            _id += _current.operation;
+            _id += ']';
         }
         return _id;
     }
@@ -284,14 +286,14 @@ public:
         return _current.adapter->getName();
     }
 
-    ConnectionInfoPtr
+    const ConnectionInfoPtr&
     getConnectionInfo() const
     {
-        if(_current.con)
+        if(_current.con && !_connectionInfo)
         {
-            return _current.con->getInfo();
+            _connectionInfo = _current.con->getInfo();
         }
-        return 0;
+        return _connectionInfo;
     }
 
     EndpointPtr
@@ -337,6 +339,7 @@ private:
     const Current& _current;
     const int _size;
     mutable string _id;
+    mutable ConnectionInfoPtr _connectionInfo;
     mutable EndpointInfoPtr _endpointInfo;
 };
 
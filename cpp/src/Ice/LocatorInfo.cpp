@@ -14,6 +14,7 @@
 #include <Ice/Functional.h>
 #include <Ice/Properties.h>
 #include <Ice/Comparable.h>
+#include <IceUtil/Random.h>
 #include <iterator>
 
 using namespace std;
@@ -27,6 +28,26 @@ IceUtil::Shared* IceInternal::upCast(LocatorTable* p) { return p; }
 namespace
 {
 
+unsigned int
+hashString(const string& s, unsigned int h = 2166136261U)
+{
+    //
+    // FNV-1a
+    //
+    for(string::const_iterator p = s.begin(); p != s.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return h;
+}
+
+int
+percentProperty(const Ice::PropertiesPtr& properties, const string& name)
+{
+    int value = properties->getPropertyAsInt(name);
+    return value < 0 ? 0 : (value > 100 ? 100 : value);
+}
+
 class ObjectRequest : public LocatorInfo::Request
 {
 public:
@@ -124,6 +145,8 @@ public:
 
 IceInternal::LocatorManager::LocatorManager(const Ice::PropertiesPtr& properties) :
     _background(properties->getPropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+    _refreshAhead(percentProperty(properties, "Ice.LocatorCacheRefreshAhead")),
+    _jitter(percentProperty(properties, "Ice.LocatorCacheJitter")),
     _tableHint(_table.end())
 {
 }
@@ -188,7 +211,7 @@ IceInternal::LocatorManager::get(const LocatorPrxPtr& loc)
         {
             t = _locatorTables.insert(_locatorTables.begin(),
                                       pair<const pair<Identity, EncodingVersion>, LocatorTablePtr>(
-                                          locatorKey, new LocatorTable()));
+                                          locatorKey, new LocatorTable(_refreshAhead, _jitter)));
         }
 
         _tableHint = _table.insert(_tableHint,
@@ -204,35 +227,41 @@ IceInternal::LocatorManager::get(const LocatorPrxPtr& loc)
     return _tableHint->second;
 }
 
-IceInternal::LocatorTable::LocatorTable()
+IceInternal::LocatorTable::LocatorTable(int refreshAhead, int jitter) :
+    _refreshAhead(refreshAhead),
+    _jitter(jitter)
 {
 }
 
 void
 IceInternal::LocatorTable::clear()
 {
-     IceUtil::Mutex::Lock sync(*this);
-
-     _adapterEndpointsMap.clear();
-     _objectMap.clear();
+    for(size_t i = 0; i < sizeof(_shards) / sizeof(*_shards); ++i)
+    {
+        IceUtil::Mutex::Lock sync(_shards[i].mutex);
+        _shards[i].adapterEndpoints.clear();
+        _shards[i].objects.clear();
+    }
 }
 
 bool
-IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints)
+IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints,
+                                               bool& refresh)
 {
+    refresh = false;
     if(ttl == 0) // No locator cache.
     {
         return false;
     }
 
-    IceUtil::Mutex::Lock sync(*this);
-
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    if(p != _adapterEndpointsMap.end())
+    AdapterEndpointsMap::iterator p = s.adapterEndpoints.find(adapter);
+    if(p != s.adapterEndpoints.end())
     {
-        endpoints = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        endpoints = p->second.value;
+        return checkTTL(p->second, ttl, refresh);
     }
     return false;
 }
@@ -240,55 +269,52 @@ IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, v
 void
 IceInternal::LocatorTable::addAdapterEndpoints(const string& adapter, const vector<EndpointIPtr>& endpoints)
 {
-    IceUtil::Mutex::Lock sync(*this);
-
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    if(p != _adapterEndpointsMap.end())
-    {
-        p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints);
-    }
-    else
-    {
-        _adapterEndpointsMap.insert(
-            make_pair(adapter, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints)));
-    }
+    Entry<vector<EndpointIPtr> >& entry = s.adapterEndpoints[adapter];
+    entry.time = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    entry.value = endpoints;
+    entry.lifetime = lifetime();
+    entry.refresh = false;
 }
 
 vector<EndpointIPtr>
 IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
-    if(p == _adapterEndpointsMap.end())
+    AdapterEndpointsMap::iterator p = s.adapterEndpoints.find(adapter);
+    if(p == s.adapterEndpoints.end())
     {
         return vector<EndpointIPtr>();
     }
 
-    vector<EndpointIPtr> endpoints = p->second.second;
+    vector<EndpointIPtr> endpoints = p->second.value;
 
-    _adapterEndpointsMap.erase(p);
+    s.adapterEndpoints.erase(p);
 
     return endpoints;
 }
 
 bool
-IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref)
+IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref, bool& refresh)
 {
+    refresh = false;
     if(ttl == 0) // No locator cache
     {
         return false;
     }
 
-    IceUtil::Mutex::Lock sync(*this);
-
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    if(p != _objectMap.end())
+    ObjectMap::iterator p = s.objects.find(id);
+    if(p != s.objects.end())
     {
-        ref = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        ref = p->second.value;
+        return checkTTL(p->second, ttl, refresh);
     }
     return false;
 }
@@ -296,48 +322,81 @@ IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, Refer
 void
 IceInternal::LocatorTable::addObjectReference(const Identity& id, const ReferencePtr& ref)
 {
-    IceUtil::Mutex::Lock sync(*this);
-
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    if(p != _objectMap.end())
-    {
-        p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref);
-    }
-    else
-    {
-        _objectMap.insert(make_pair(id, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref)));
-    }
+    Entry<ReferencePtr>& entry = s.objects[id];
+    entry.time = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    entry.value = ref;
+    entry.lifetime = lifetime();
+    entry.refresh = false;
 }
 
 ReferencePtr
 IceInternal::LocatorTable::removeObjectReference(const Identity& id)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
-    if(p == _objectMap.end())
+    ObjectMap::iterator p = s.objects.find(id);
+    if(p == s.objects.end())
     {
         return 0;
     }
 
-    ReferencePtr ref = p->second.second;
-    _objectMap.erase(p);
+    ReferencePtr ref = p->second.value;
+    s.objects.erase(p);
     return ref;
 }
 
-bool
-IceInternal::LocatorTable::checkTTL(const IceUtil::Time& time, int ttl) const
+IceInternal::LocatorTable::Shard&
+IceInternal::LocatorTable::shard(const string& adapter)
+{
+    return _shards[hashString(adapter) % (sizeof(_shards) / sizeof(*_shards))];
+}
+
+IceInternal::LocatorTable::Shard&
+IceInternal::LocatorTable::shard(const Identity& id)
+{
+    return _shards[hashString(id.category, hashString(id.name)) % (sizeof(_shards) / sizeof(*_shards))];
+}
+
+int
+IceInternal::LocatorTable::lifetime() const
+{
+    //
+    // With jitter, entries cached at the same time don't all expire at the
+    // same time, which would otherwise cause a burst of locator requests.
+    //
+    return _jitter > 0 ? 100 - static_cast<int>(IceUtilInternal::random(_jitter + 1)) : 100;
+}
+
+template<typename T> bool
+IceInternal::LocatorTable::checkTTL(Entry<T>& entry, int ttl, bool& refresh) const
 {
     assert(ttl != 0);
     if (ttl < 0) // TTL = infinite
     {
         return true;
     }
-    else
+
+    IceUtil::Time age = IceUtil::Time::now(IceUtil::Time::Monotonic) - entry.time;
+    IceUtil::Time valid = IceUtil::Time::seconds(ttl) * entry.lifetime / 100;
+    if(age > valid)
+    {
+        return false;
+    }
+
+    //
+    // Refresh the entry ahead of its expiration if it's in the last
+    // _refreshAhead percent of its lifetime.
+    //
+    if(_refreshAhead > 0 && !entry.refresh && age > valid * (100 - _refreshAhead) / 100)
     {
-        return IceUtil::Time::now(IceUtil::Time::Monotonic) - time <= IceUtil::Time::seconds(ttl);
+        entry.refresh = true;
+        refresh = true;
     }
+    return true;
 }
 
 void
@@ -554,9 +613,10 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
 {
     assert(ref->isIndirect());
     vector<EndpointIPtr> endpoints;
+    bool refresh;
     if(!ref->isWellKnown())
     {
-        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints))
+        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints, refresh))
         {
             if(_background && !endpoints.empty())
             {
@@ -568,11 +628,19 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
                 return;
             }
         }
+        else if(refresh)
+        {
+            //
+            // The cached endpoints are about to expire, refresh them in the
+            // background and use them in the meantime.
+            //
+            getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
+        }
     }
     else
     {
         ReferencePtr r;
-        if(!_table->getObjectReference(ref->getIdentity(), ttl, r))
+        if(!_table->getObjectReference(ref->getIdentity(), ttl, r, refresh))
         {
             if(_background && r)
             {
@@ -584,6 +652,10 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
                 return;
             }
         }
+        else if(refresh)
+        {
+            getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
+        }
 
         if(!r->isIndirect())
         {
@@ -39,6 +39,8 @@ public:
 private:
 
     const bool _background;
+    const int _refreshAhead;
+    const int _jitter;
 
 #ifdef ICE_CPP11_MAPPING
     using LocatorInfoTable = std::map<std::shared_ptr<Ice::LocatorPrx>,
@@ -53,28 +55,63 @@ private:
     std::map<std::pair<Ice::Identity, Ice::EncodingVersion>, LocatorTablePtr> _locatorTables;
 };
 
-class LocatorTable : public IceUtil::Shared, public IceUtil::Mutex
+class LocatorTable : public IceUtil::Shared
 {
 public:
 
-    LocatorTable();
+    LocatorTable(int, int);
 
     void clear();
 
-    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&);
+    //
+    // The lookup methods return true if the cached entry is still valid.
+    // The refresh parameter is set to true if the entry is valid but
+    // close to expiration and should be refreshed in the background. It
+    // is only set once for a given entry.
+    //
+    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&, bool&);
     void addAdapterEndpoints(const std::string&, const ::std::vector<EndpointIPtr>&);
     ::std::vector<EndpointIPtr> removeAdapterEndpoints(const std::string&);
 
-    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&);
+    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&, bool&);
     void addObjectReference(const Ice::Identity&, const ReferencePtr&);
     ReferencePtr removeObjectReference(const Ice::Identity&);
 
 private:
 
-    bool checkTTL(const IceUtil::Time&, int) const;
+    template<typename T> struct Entry
+    {
+        IceUtil::Time time;
+        T value;
+        int lifetime; // Percentage of the TTL the entry stays valid, lower than 100 with jitter.
+        bool refresh;
+    };
+
+    typedef std::map<std::string, Entry<std::vector<EndpointIPtr> > > AdapterEndpointsMap;
+    typedef std::map<Ice::Identity, Entry<ReferencePtr> > ObjectMap;
+
+    //
+    // The entries are spread over shards, each protected by its own
+    // mutex, so that concurrent lookups of different entries don't
+    // serialize on a single mutex.
+    //
+    struct Shard
+    {
+        IceUtil::Mutex mutex;
+        AdapterEndpointsMap adapterEndpoints;
+        ObjectMap objects;
+    };
+
+    Shard& shard(const std::string&);
+    Shard& shard(const Ice::Identity&);
+
+    int lifetime() const;
+
+    template<typename T> bool checkTTL(Entry<T>&, int, bool&) const;
 
-    std::map<std::string, std::pair<IceUtil::Time, std::vector<EndpointIPtr> > > _adapterEndpointsMap;
-    std::map<Ice::Identity, std::pair<IceUtil::Time, ReferencePtr> > _objectMap;
+    const int _refreshAhead;
+    const int _jitter;
+    Shard _shards[16];
 };
 
 class LocatorInfo : public IceUtil::Shared, public IceUtil::Mutex
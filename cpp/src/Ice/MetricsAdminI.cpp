@@ -11,7 +11,10 @@
 #include <Ice/Instance.h>
 #include <Ice/LoggerUtil.h>
 
+#include <Ice/ThreadLocal.h>
+
 #include <IceUtil/StringUtil.h>
+#include <IceUtil/Atomic.h>
 
 using namespace std;
 using namespace Ice;
@@ -21,6 +24,8 @@ using namespace IceMX;
 namespace
 {
 
+const size_t histogramBuckets = 304;
+
 const string suffixes[] =
 {
     "Disabled",
@@ -28,6 +33,7 @@ const string suffixes[] =
     "Accept.*",
     "Reject.*",
     "RetainDetached",
+    "Histogram",
     "Map.*",
 };
 
@@ -85,9 +91,37 @@ parseRule(const PropertiesPtr& properties, const string& name)
     return regexps;
 }
 
+//
+// The results of the Accept and Reject regular expressions are memoized by
+// each thread, without any locking. The attribute values usually take a small
+// number of values (endpoints, operations, identities...) so each thread only
+// evaluates a regular expression once for each value. The results are keyed
+// by the identifier of the regular expression rather than by its address so
+// the results of a destroyed regular expression are never reused.
+//
+IceUtilInternal::Atomic regExpCount(0);
+const size_t maxMatches = 1024;
+
+class MatchCache
+{
+public:
+
+    MatchCache() :
+        size(0)
+    {
+    }
+
+    map<int, map<string, bool> > matches;
+    size_t size;
+};
+
+ThreadLocal<MatchCache> matchCache;
+
 }
 
-MetricsMapI::RegExp::RegExp(const string& attribute, const string& regexp) : _attribute(attribute)
+MetricsMapI::RegExp::RegExp(const string& attribute, const string& regexp) :
+    _attribute(attribute),
+    _id(++regExpCount)
 {
 #ifdef __MINGW32__
     //
@@ -122,6 +156,36 @@ MetricsMapI::RegExp::~RegExp()
 
 bool
 MetricsMapI::RegExp::match(const string& value)
+{
+    MatchCache* cache = matchCache.get(true);
+    if(!cache)
+    {
+        return doMatch(value);
+    }
+
+    map<int, map<string, bool> >::const_iterator p = cache->matches.find(_id);
+    if(p != cache->matches.end())
+    {
+        map<string, bool>::const_iterator q = p->second.find(value);
+        if(q != p->second.end())
+        {
+            return q->second;
+        }
+    }
+
+    bool matched = doMatch(value);
+    if(cache->size >= maxMatches)
+    {
+        cache->matches.clear(); // Too many distinct values, start over.
+        cache->size = 0;
+    }
+    cache->matches[_id].insert(make_pair(value, matched));
+    ++cache->size;
+    return matched;
+}
+
+bool
+MetricsMapI::RegExp::doMatch(const string& value)
 {
 #ifdef __MINGW32__
     //
@@ -149,7 +213,8 @@ MetricsMapI::MetricsMapI(const std::string& mapPrefix, const PropertiesPtr& prop
     _properties(properties->getPropertiesForPrefix(mapPrefix)),
     _retain(properties->getPropertyAsIntWithDefault(mapPrefix + "RetainDetached", 10)),
     _accept(parseRule(properties, mapPrefix + "Accept")),
-    _reject(parseRule(properties, mapPrefix + "Reject"))
+    _reject(parseRule(properties, mapPrefix + "Reject")),
+    _histogram(properties->getPropertyAsInt(mapPrefix + "Histogram") > 0)
 {
     validateProperties(mapPrefix, properties);
 
@@ -208,7 +273,8 @@ MetricsMapI::MetricsMapI(const MetricsMapI& map) :
     _groupBySeparators(map._groupBySeparators),
     _retain(map._retain),
     _accept(map._accept),
-    _reject(map._reject)
+    _reject(map._reject),
+    _histogram(map._histogram)
 {
 }
 
@@ -218,6 +284,46 @@ MetricsMapI::getProperties() const
     return _properties;
 }
 
+void
+MetricsMapI::addToHistogram(LongSeq& histogram, Ice::Long lifetime)
+{
+    if(histogram.empty())
+    {
+        histogram.resize(histogramBuckets);
+    }
+
+    size_t bucket;
+    if(lifetime < 8)
+    {
+        bucket = lifetime > 0 ? static_cast<size_t>(lifetime) : 0;
+    }
+    else
+    {
+        //
+        // Find the power of two of the lifetime, the 3 bits following the
+        // most significant bit give the bucket within the power of two.
+        //
+        size_t shift = 0;
+        while((lifetime >> shift) >= 16)
+        {
+            ++shift;
+        }
+        bucket = std::min(8 + shift * 8 + static_cast<size_t>((lifetime >> shift) - 8), histogramBuckets - 1);
+    }
+    ++histogram[bucket];
+}
+
+LongSeq
+MetricsMapI::trimHistogram(const LongSeq& histogram)
+{
+    LongSeq::const_iterator p = histogram.end();
+    while(p != histogram.begin() && *(p - 1) == 0)
+    {
+        --p;
+    }
+    return LongSeq(histogram.begin(), p);
+}
+
 MetricsMapFactory::~MetricsMapFactory()
 {
     // Out of line to avoid weak vtable
@@ -364,6 +470,17 @@ MetricsViewI::getFailures(const string& mapName, const string& id)
     return MetricsFailures();
 }
 
+MetricsHistograms
+MetricsViewI::getHistograms(const string& mapName)
+{
+    map<string, MetricsMapIPtr>::const_iterator p = _maps.find(mapName);
+    if(p != _maps.end())
+    {
+        return p->second->getHistograms();
+    }
+    return MetricsHistograms();
+}
+
 vector<string>
 MetricsViewI::getMaps() const
 {
@@ -612,6 +729,22 @@ MetricsAdminI::getMetricsFailures(const string& viewName, const string& map, con
     return MetricsFailures();
 }
 
+MetricsHistograms
+#ifdef ICE_CPP11_MAPPING
+MetricsAdminI::getMetricsHistograms(string viewName, string map, const Current&)
+#else
+MetricsAdminI::getMetricsHistograms(const string& viewName, const string& map, const Current&)
+#endif
+{
+    Lock sync(*this);
+    MetricsViewIPtr view = getMetricsView(viewName);
+    if(view)
+    {
+        return view->getHistograms(map);
+    }
+    return MetricsHistograms();
+}
+
 vector<MetricsMapIPtr>
 MetricsAdminI::getMaps(const string& mapName) const
 {
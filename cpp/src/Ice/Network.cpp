@@ -135,46 +135,6 @@ public:
 };
 #   endif
 
-void
-sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
-{
-    if(selType == Ice::ICE_ENUM(EndpointSelectionType, Random))
-    {
-        IceUtilInternal::shuffle(addrs.begin(), addrs.end());
-    }
-
-    if(protocol == EnableBoth)
-    {
-#ifdef ICE_CPP11_COMPILER
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(),
-                             [](const Address& ss)
-                             {
-                                 return ss.saStorage.ss_family == AF_INET6;
-                             });
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(),
-                             [](const Address& ss)
-                             {
-                                 return ss.saStorage.ss_family != AF_INET6;
-                             });
-        }
-#else
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
-        }
-#endif
-    }
-}
-
 void
 setTcpNoDelay(SOCKET fd)
 {
@@ -1238,6 +1198,47 @@ IceInternal::getAddresses(const string& host, int port, ProtocolSupport protocol
     sortAddresses(result, protocol, selType, preferIPv6);
     return result;
 }
+
+void
+IceInternal::sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
+                           bool preferIPv6)
+{
+    if(selType == Ice::ICE_ENUM(EndpointSelectionType, Random))
+    {
+        IceUtilInternal::shuffle(addrs.begin(), addrs.end());
+    }
+
+    if(protocol == EnableBoth)
+    {
+#ifdef ICE_CPP11_COMPILER
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(),
+                             [](const Address& ss)
+                             {
+                                 return ss.saStorage.ss_family == AF_INET6;
+                             });
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(),
+                             [](const Address& ss)
+                             {
+                                 return ss.saStorage.ss_family != AF_INET6;
+                             });
+        }
+#else
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
+        }
+#endif
+    }
+}
 #endif
 
 #ifdef ICE_OS_UWP
@@ -2288,6 +2289,36 @@ IceInternal::setReuseAddress(SOCKET fd, bool reuse)
 }
 #endif
 
+#if defined(ICE_OS_UWP) || !defined(SO_REUSEPORT)
+bool
+IceInternal::isReusePortSupported()
+{
+    return false;
+}
+
+void
+IceInternal::setReusePort(SOCKET, bool)
+{
+}
+#else
+bool
+IceInternal::isReusePortSupported()
+{
+    return true;
+}
+
+void
+IceInternal::setReusePort(SOCKET fd, bool reuse)
+{
+    int flag = reuse ? 1 : 0;
+    if(setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char*>(&flag), int(sizeof(int))) == SOCKET_ERROR)
+    {
+        closeSocketNoThrow(fd);
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+}
+#endif
+
 #ifdef ICE_OS_UWP
 namespace
 {
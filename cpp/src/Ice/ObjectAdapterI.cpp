@@ -28,6 +28,7 @@
 #include <Ice/TraceLevels.h>
 #include <Ice/PropertyNames.h>
 #include <Ice/ConsoleUtil.h>
+#include <Ice/Network.h>
 
 #ifdef _WIN32
 #   include <sys/timeb.h>
@@ -64,6 +65,24 @@ inline EndpointIPtr toEndpointI(const EndpointPtr& endp)
     return ICE_DYNAMIC_CAST(EndpointI, endp);
 }
 
+inline bool containsEndpoint(const vector<EndpointIPtr>& endpoints, const EndpointIPtr& endp)
+{
+    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        if(targetEqualTo(*p, endp))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool isTcpEndpoint(const EndpointIPtr& endp)
+{
+    Short type = endp->type();
+    return type == TCPEndpointType || type == SSLEndpointType || type == WSEndpointType || type == WSSEndpointType;
+}
+
 }
 
 string
@@ -636,18 +655,21 @@ Ice::ObjectAdapterI::getEndpoints() const ICE_NOEXCEPT
 {
     IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
 
-    EndpointSeq endpoints;
-    transform(_incomingConnectionFactories.begin(), _incomingConnectionFactories.end(),
-            back_inserter(endpoints),
-#ifdef ICE_CPP11_MAPPING
-            [](const IncomingConnectionFactoryPtr& factory)
-            {
-                return factory->endpoint();
-            });
-#else
-            Ice::constMemFun(&IncomingConnectionFactory::endpoint));
-#endif
-    return endpoints;
+    //
+    // Skip the duplicate endpoints of the additional acceptors created
+    // for the <name>.Acceptors property.
+    //
+    vector<EndpointIPtr> endpoints;
+    for(vector<IncomingConnectionFactoryPtr>::const_iterator p = _incomingConnectionFactories.begin();
+        p != _incomingConnectionFactories.end(); ++p)
+    {
+        EndpointIPtr endpoint = (*p)->endpoint();
+        if(!containsEndpoint(endpoints, endpoint))
+        {
+            endpoints.push_back(endpoint);
+        }
+    }
+    return EndpointSeq(endpoints.begin(), endpoints.end());
 }
 
 void
@@ -1074,19 +1096,63 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
             // fill in the real port number.
             //
             vector<EndpointIPtr> endpoints = parseEndpoints(properties->getProperty(_name + ".Endpoints"), true);
+
+            //
+            // With multiple acceptors, each TCP based endpoint is listened on by
+            // several incoming connection factories bound to the same address with
+            // SO_REUSEPORT. The kernel distributes the incoming connections among
+            // them and the adapter thread pool threads can accept and validate the
+            // new connections concurrently.
+            //
+            int acceptors = properties->getPropertyAsIntWithDefault(_name + ".Acceptors", 1);
+            if(acceptors > 1 && !isReusePortSupported())
+            {
+                Warning out(_instance->initializationData().logger);
+                out << "object adapter `" << _name << "': ignoring " << _name << ".Acceptors, "
+                    << "SO_REUSEPORT is not supported on this platform";
+                acceptors = 1;
+            }
+
             for(vector<EndpointIPtr>::iterator p = endpoints.begin(); p != endpoints.end(); ++p)
             {
                 EndpointIPtr publishedEndpoint;
                 vector<EndpointIPtr> expanded = (*p)->expandHost(publishedEndpoint);
                 for(vector<EndpointIPtr>::iterator q = expanded.begin(); q != expanded.end(); ++q)
                 {
+                    //
+                    // The sockets of all the acceptors of the endpoint are bound
+                    // with SO_REUSEPORT.
+                    //
+                    bool reusePort = acceptors > 1 && isTcpEndpoint(*q);
                     IncomingConnectionFactoryPtr factory = ICE_MAKE_SHARED(IncomingConnectionFactory,
                                                                            _instance,
                                                                            *q,
                                                                            publishedEndpoint,
-                                                                           ICE_SHARED_FROM_THIS);
+                                                                           ICE_SHARED_FROM_THIS,
+                                                                           reusePort);
                     factory->initialize();
                     _incomingConnectionFactories.push_back(factory);
+
+                    //
+                    // The additional acceptors listen on the endpoint of the first
+                    // factory which has the port assigned by the system if the
+                    // endpoint port is 0.
+                    //
+                    if(reusePort)
+                    {
+                        EndpointIPtr endpoint = factory->endpoint();
+                        for(int i = 1; i < acceptors; ++i)
+                        {
+                            factory = ICE_MAKE_SHARED(IncomingConnectionFactory,
+                                                      _instance,
+                                                      endpoint,
+                                                      publishedEndpoint,
+                                                      ICE_SHARED_FROM_THIS,
+                                                      true);
+                            factory->initialize();
+                            _incomingConnectionFactories.push_back(factory);
+                        }
+                    }
                 }
             }
             if(endpoints.empty())
@@ -1315,10 +1381,11 @@ ObjectAdapterI::computePublishedEndpoints()
                 {
                     //
                     // Check for duplicate endpoints, this might occur if an endpoint with a DNS name
-                    // expands to multiple addresses. In this case, multiple incoming connection
-                    // factories can point to the same published endpoint.
+                    // expands to multiple addresses or if the endpoint has multiple acceptors. In
+                    // this case, multiple incoming connection factories can point to the same
+                    // published endpoint.
                     //
-                    if(::find(endpoints.begin(), endpoints.end(), *p) == endpoints.end())
+                    if(!containsEndpoint(endpoints, *p))
                     {
                         endpoints.push_back(*p);
                     }
@@ -1453,6 +1520,7 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ACM.Close",
         "ACM.Heartbeat",
         "ACM.Timeout",
+        "Acceptors",
         "AdapterId",
         "Endpoints",
         "Locator",
@@ -1481,6 +1549,8 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Router.LocatorCacheTimeout",
         "Router.InvocationTimeout",
         "ProxyOptions",
+        "ThreadPool.Affinity",
+        "ThreadPool.NumaNode",
         "ThreadPool.Size",
         "ThreadPool.SizeMax",
         "ThreadPool.SizeWarn",
@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Thu Jul  2 14:55:02 2020
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 07:26:12 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -28,6 +28,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ACM.Heartbeat", false, 0),
     IceInternal::Property("Ice.Admin.ACM.Close", false, 0),
     IceInternal::Property("Ice.Admin.ACM", false, 0),
+    IceInternal::Property("Ice.Admin.Acceptors", false, 0),
     IceInternal::Property("Ice.Admin.AdapterId", false, 0),
     IceInternal::Property("Ice.Admin.Endpoints", false, 0),
     IceInternal::Property("Ice.Admin.Locator.EndpointSelection", false, 0),
@@ -53,13 +54,17 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.Context.*", false, 0),
     IceInternal::Property("Ice.Admin.Router", false, 0),
     IceInternal::Property("Ice.Admin.ProxyOptions", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Backend", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.Size", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.StackSize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
@@ -72,11 +77,18 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BufferPool.MaxBuffers", false, 0),
+    IceInternal::Property("Ice.BufferPool.MaxSize", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClassGraphDepthMax", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
+    IceInternal::Property("Ice.Compression.Compressor", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
+    IceInternal::Property("Ice.Compression.Threshold", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
+    IceInternal::Property("Ice.CollocationDirectDispatch", false, 0),
+    IceInternal::Property("Ice.ConnectRace.Connectors", false, 0),
+    IceInternal::Property("Ice.ConnectRace.Delay", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
@@ -115,10 +127,14 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
+    IceInternal::Property("Ice.HostResolver.CacheTimeout", false, 0),
+    IceInternal::Property("Ice.HostResolver.Threads", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
     IceInternal::Property("Ice.IPv6", false, 0),
+    IceInternal::Property("Ice.LocatorCacheJitter", false, 0),
+    IceInternal::Property("Ice.LocatorCacheRefreshAhead", false, 0),
     IceInternal::Property("Ice.LogFile", false, 0),
     IceInternal::Property("Ice.LogFile.SizeMax", false, 0),
     IceInternal::Property("Ice.LogStdErr.Convert", false, 0),
@@ -146,24 +162,34 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.StdErr", false, 0),
     IceInternal::Property("Ice.StdOut", false, 0),
     IceInternal::Property("Ice.SyslogFacility", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Affinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Backend", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.SizeWarn", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.NumaNode", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.StackSize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.WorkStealing", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Affinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Backend", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.NumaNode", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.StackSize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.WorkStealing", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.TimerTick", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
+    IceInternal::Property("Ice.Trace.BufferPool", false, 0),
     IceInternal::Property("Ice.Trace.Locator", false, 0),
     IceInternal::Property("Ice.Trace.Network", false, 0),
     IceInternal::Property("Ice.Trace.Protocol", false, 0),
@@ -202,6 +228,7 @@ const IceInternal::Property IceMXPropsData[] =
     IceInternal::Property("IceMX.Metrics.*.RetainDetached", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Accept", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Reject", false, 0),
+    IceInternal::Property("IceMX.Metrics.*.Histogram", false, 0),
     IceInternal::Property("IceMX.Metrics.*", false, 0),
 };
 
@@ -215,6 +242,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ACM", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Acceptors", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.AdapterId", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.EndpointSelection", false, 0),
@@ -240,18 +268,23 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Router.Context.*", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ProxyOptions", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Size", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Acceptors", false, 0),
     IceInternal::Property("IceDiscovery.Reply.AdapterId", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.EndpointSelection", false, 0),
@@ -277,18 +310,23 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Router.Context.*", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ProxyOptions", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Size", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Acceptors", false, 0),
     IceInternal::Property("IceDiscovery.Locator.AdapterId", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.EndpointSelection", false, 0),
@@ -314,13 +352,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Router.Context.*", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ProxyOptions", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Size", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
@@ -342,6 +384,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Acceptors", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.AdapterId", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.EndpointSelection", false, 0),
@@ -367,18 +410,23 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Context.*", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ProxyOptions", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Size", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Acceptors", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.AdapterId", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.EndpointSelection", false, 0),
@@ -404,13 +452,17 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Context.*", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ProxyOptions", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Size", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Lookup", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Timeout", false, 0),
@@ -476,6 +528,7 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceBridge.Source.ACM.Close", false, 0),
     IceInternal::Property("IceBridge.Source.ACM", false, 0),
+    IceInternal::Property("IceBridge.Source.Acceptors", false, 0),
     IceInternal::Property("IceBridge.Source.AdapterId", false, 0),
     IceInternal::Property("IceBridge.Source.Endpoints", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.EndpointSelection", false, 0),
@@ -501,13 +554,17 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.Router.Context.*", false, 0),
     IceInternal::Property("IceBridge.Source.Router", false, 0),
     IceInternal::Property("IceBridge.Source.ProxyOptions", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.Size", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceBridge.Source.MessageSizeMax", false, 0),
     IceInternal::Property("IceBridge.Target.Endpoints", false, 0),
     IceInternal::Property("IceBridge.InstanceName", false, 0),
@@ -531,6 +588,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ACM", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Acceptors", false, 0),
     IceInternal::Property("IceGridAdmin.Server.AdapterId", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.EndpointSelection", false, 0),
@@ -556,13 +614,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.Router.Context.*", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ProxyOptions", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGridAdmin.Server.MessageSizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Address", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Interface", false, 0),
@@ -571,6 +633,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Acceptors", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.AdapterId", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, 0),
@@ -596,18 +659,23 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Context.*", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ProxyOptions", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Acceptors", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.AdapterId", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.EndpointSelection", false, 0),
@@ -633,13 +701,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Context.*", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ProxyOptions", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
@@ -655,6 +727,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ACM", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Acceptors", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.AdapterId", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Endpoints", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.EndpointSelection", false, 0),
@@ -680,19 +753,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Node.ACM", false, 0),
+    IceInternal::Property("IceGrid.Node.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Node.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Node.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.EndpointSelection", false, 0),
@@ -718,14 +796,19 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Node.Router", false, 0),
     IceInternal::Property("IceGrid.Node.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.AdapterLoadPeriod", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
@@ -755,6 +838,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Context.*", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper", false, 0),
     IceInternal::Property("IceGrid.Node.WaitTime", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdapterLoadTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminCryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionCached", false, 0),
@@ -771,6 +855,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, 0),
@@ -796,13 +881,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
@@ -818,6 +907,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.EndpointSelection", false, 0),
@@ -843,20 +933,26 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.ChangeLogSize", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.EndpointSelection", false, 0),
@@ -882,13 +978,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
@@ -899,6 +999,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.EndpointSelection", false, 0),
@@ -924,17 +1025,22 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.ObserverInitPageSize", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, 0),
@@ -953,6 +1059,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.EndpointSelection", false, 0),
@@ -978,19 +1085,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, 0),
@@ -1016,13 +1128,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Backend", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
@@ -1062,6 +1178,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ACM.Heartbeat", false, 0),
     IceInternal::Property("IcePatch2.ACM.Close", false, 0),
     IceInternal::Property("IcePatch2.ACM", false, 0),
+    IceInternal::Property("IcePatch2.Acceptors", false, 0),
     IceInternal::Property("IcePatch2.AdapterId", false, 0),
     IceInternal::Property("IcePatch2.Endpoints", false, 0),
     IceInternal::Property("IcePatch2.Locator.EndpointSelection", false, 0),
@@ -1087,13 +1204,17 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.Context.*", false, 0),
     IceInternal::Property("IcePatch2.Router", false, 0),
     IceInternal::Property("IcePatch2.ProxyOptions", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Backend", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.Size", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
@@ -1150,6 +1271,9 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.ProtocolVersionMin", false, 0),
     IceInternal::Property("IceSSL.Random", false, 0),
     IceInternal::Property("IceSSL.SchannelStrongCrypto", false, 0),
+    IceInternal::Property("IceSSL.SessionCache.Size", false, 0),
+    IceInternal::Property("IceSSL.SessionCache.TicketKeyLifetime", false, 0),
+    IceInternal::Property("IceSSL.SessionCache.Timeout", false, 0),
     IceInternal::Property("IceSSL.Trace.Security", false, 0),
     IceInternal::Property("IceSSL.TrustOnly", false, 0),
     IceInternal::Property("IceSSL.TrustOnly.Client", false, 0),
@@ -1195,6 +1319,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ACM.Heartbeat", false, 0),
     IceInternal::Property("Glacier2.Client.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Client.ACM", false, 0),
+    IceInternal::Property("Glacier2.Client.Acceptors", false, 0),
     IceInternal::Property("Glacier2.Client.AdapterId", false, 0),
     IceInternal::Property("Glacier2.Client.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.EndpointSelection", false, 0),
@@ -1220,13 +1345,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.Context.*", false, 0),
     IceInternal::Property("Glacier2.Client.Router", false, 0),
     IceInternal::Property("Glacier2.Client.ProxyOptions", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Backend", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.Size", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.StackSize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
@@ -1270,6 +1399,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ACM.Heartbeat", false, 0),
     IceInternal::Property("Glacier2.Server.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Server.ACM", false, 0),
+    IceInternal::Property("Glacier2.Server.Acceptors", false, 0),
     IceInternal::Property("Glacier2.Server.AdapterId", false, 0),
     IceInternal::Property("Glacier2.Server.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.EndpointSelection", false, 0),
@@ -1295,13 +1425,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.Context.*", false, 0),
     IceInternal::Property("Glacier2.Server.Router", false, 0),
     IceInternal::Property("Glacier2.Server.ProxyOptions", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Backend", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.Size", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.SizeWarn", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.NumaNode", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.StackSize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
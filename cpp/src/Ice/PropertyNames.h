@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Thu Jul  2 14:55:02 2020
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 07:26:12 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -1393,6 +1393,19 @@ ICE_OBJECT_PRX::_getRequestHandler()
     return _reference->getRequestHandler(ICE_SHARED_FROM_THIS);
 }
 
+#ifdef ICE_CPP11_MAPPING
+IceInternal::RequestHandlerPtr
+ICE_OBJECT_PRX::_getCachedRequestHandler()
+{
+    if(_reference->getCacheConnection())
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        return _requestHandler;
+    }
+    return nullptr;
+}
+#endif
+
 IceInternal::BatchRequestQueuePtr
 ICE_OBJECT_PRX::_getBatchRequestQueue()
 {
@@ -0,0 +1,170 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/RequestTable.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+const size_t initialCapacity = 16;
+
+bool
+compareRequestIds(const pair<Int, OutgoingAsyncBasePtr>& lhs, const pair<Int, OutgoingAsyncBasePtr>& rhs)
+{
+    return lhs.first < rhs.first;
+}
+
+}
+
+IceInternal::RequestTable::RequestTable() :
+    _size(0)
+{
+}
+
+void
+IceInternal::RequestTable::add(Int requestId, const OutgoingAsyncBasePtr& outAsync)
+{
+    assert(requestId > 0);
+    if(_ring.empty())
+    {
+        _ring.resize(initialCapacity);
+    }
+
+    Entry* entry = &_ring[requestId & (_ring.size() - 1)];
+    if(entry->requestId != 0 && _size >= _ring.size() / 2)
+    {
+        grow();
+        entry = &_ring[requestId & (_ring.size() - 1)];
+    }
+
+    if(entry->requestId == 0)
+    {
+        entry->requestId = requestId;
+        entry->outAsync = outAsync;
+    }
+    else
+    {
+        _overflow.insert(make_pair(requestId, outAsync));
+    }
+    ++_size;
+}
+
+OutgoingAsyncBasePtr
+IceInternal::RequestTable::remove(Int requestId)
+{
+    OutgoingAsyncBasePtr outAsync;
+    if(!_ring.empty())
+    {
+        Entry& entry = _ring[requestId & (_ring.size() - 1)];
+        if(entry.requestId == requestId)
+        {
+            entry.requestId = 0;
+            std::swap(outAsync, entry.outAsync);
+            --_size;
+            return outAsync;
+        }
+    }
+
+    if(!_overflow.empty())
+    {
+        map<Int, OutgoingAsyncBasePtr>::iterator p = _overflow.find(requestId);
+        if(p != _overflow.end())
+        {
+            outAsync = p->second;
+            _overflow.erase(p);
+            --_size;
+        }
+    }
+    return outAsync;
+}
+
+Int
+IceInternal::RequestTable::find(const OutgoingAsyncBasePtr& outAsync) const
+{
+    for(vector<Entry>::const_iterator p = _ring.begin(); p != _ring.end(); ++p)
+    {
+        if(p->requestId != 0 && p->outAsync.get() == outAsync.get())
+        {
+            return p->requestId;
+        }
+    }
+
+    for(map<Int, OutgoingAsyncBasePtr>::const_iterator p = _overflow.begin(); p != _overflow.end(); ++p)
+    {
+        if(p->second.get() == outAsync.get())
+        {
+            return p->first;
+        }
+    }
+    return 0;
+}
+
+void
+IceInternal::RequestTable::clear(vector<OutgoingAsyncBasePtr>& requests)
+{
+    vector<pair<Int, OutgoingAsyncBasePtr> > sorted;
+    sorted.reserve(_size);
+    for(vector<Entry>::iterator p = _ring.begin(); p != _ring.end(); ++p)
+    {
+        if(p->requestId != 0)
+        {
+            sorted.push_back(make_pair(p->requestId, p->outAsync));
+        }
+    }
+    sorted.insert(sorted.end(), _overflow.begin(), _overflow.end());
+    sort(sorted.begin(), sorted.end(), compareRequestIds);
+
+    for(vector<pair<Int, OutgoingAsyncBasePtr> >::const_iterator p = sorted.begin(); p != sorted.end(); ++p)
+    {
+        requests.push_back(p->second);
+    }
+
+    vector<Entry>().swap(_ring);
+    _overflow.clear();
+    _size = 0;
+}
+
+void
+IceInternal::RequestTable::grow()
+{
+    //
+    // Entries in distinct slots of the current ring are also in distinct
+    // slots of the new ring since the new mask only adds a bit to the
+    // current mask. Overflow entries are moved to the ring if their new
+    // slot is free.
+    //
+    vector<Entry> ring(_ring.size() * 2);
+    for(vector<Entry>::iterator p = _ring.begin(); p != _ring.end(); ++p)
+    {
+        if(p->requestId != 0)
+        {
+            Entry& entry = ring[p->requestId & (ring.size() - 1)];
+            entry.requestId = p->requestId;
+            std::swap(entry.outAsync, p->outAsync);
+        }
+    }
+
+    map<Int, OutgoingAsyncBasePtr>::iterator p = _overflow.begin();
+    while(p != _overflow.end())
+    {
+        Entry& entry = ring[p->first & (ring.size() - 1)];
+        if(entry.requestId == 0)
+        {
+            entry.requestId = p->first;
+            entry.outAsync = p->second;
+            _overflow.erase(p++);
+        }
+        else
+        {
+            ++p;
+        }
+    }
+    _ring.swap(ring);
+}
@@ -0,0 +1,78 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_REQUEST_TABLE_H
+#define ICE_REQUEST_TABLE_H
+
+#include <Ice/OutgoingAsync.h>
+
+#include <map>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The table of the outstanding twoway requests of a connection, keyed by
+// request ID. Request IDs are allocated in increasing order and most
+// replies arrive in the order of the requests, so the table is a ring
+// indexed by the request ID modulo its capacity. A request is only put in
+// the overflow map if its ring slot is still used by an older request
+// while the ring is less than half full, otherwise the ring is doubled.
+// Adding or removing a request doesn't allocate memory once the ring has
+// grown to the number of outstanding requests.
+//
+class RequestTable : private IceUtil::noncopyable
+{
+public:
+
+    RequestTable();
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    void add(Ice::Int, const OutgoingAsyncBasePtr&);
+
+    //
+    // Removes and returns the request with the given ID, or null if there's
+    // no such request.
+    //
+    OutgoingAsyncBasePtr remove(Ice::Int);
+
+    //
+    // Returns the ID of the given request, or 0 if the request isn't in the
+    // table. This is a linear search, it's only used for canceled requests.
+    //
+    Ice::Int find(const OutgoingAsyncBasePtr&) const;
+
+    //
+    // Removes all the requests and adds them to the given vector in request
+    // ID order.
+    //
+    void clear(std::vector<OutgoingAsyncBasePtr>&);
+
+private:
+
+    void grow();
+
+    struct Entry
+    {
+        Entry() : requestId(0)
+        {
+        }
+
+        Ice::Int requestId; // 0 if the entry is free.
+        OutgoingAsyncBasePtr outAsync;
+    };
+
+    std::vector<Entry> _ring;
+    std::map<Ice::Int, OutgoingAsyncBasePtr> _overflow;
+    size_t _size;
+};
+
+}
+
+#endif
@@ -7,8 +7,14 @@
 #include <Ice/Instance.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/LocalException.h>
+#include <Ice/TraceLevels.h>
 #include <IceUtil/Time.h>
 
+#if defined(ICE_USE_IO_URING)
+#   include <sys/mman.h>
+#   include <deque>
+#endif
+
 #ifdef ICE_USE_CFSTREAM
 #   include <CoreFoundation/CoreFoundation.h>
 #   include <CoreFoundation/CFStream.h>
@@ -242,6 +248,480 @@ Selector::completed(EventHandler* handler, SocketOperation op)
 
 #elif defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_SELECT) || defined(ICE_USE_POLL)
 
+#if defined(ICE_USE_IO_URING)
+
+//
+// Readiness notifications with io_uring. The file descriptors are monitored
+// with one-shot poll requests which are re-armed when the selector waits
+// again. This provides the level-triggered semantics of epoll, while the
+// registration changes are batched and submitted with the wait.
+//
+class IceInternal::IoUring : private IceUtil::Mutex
+{
+public:
+
+    IoUring(unsigned int);
+    ~IoUring();
+
+    int ctl(int, SOCKET, struct epoll_event*);
+    int wait(struct epoll_event*, int, int);
+
+private:
+
+    struct Poll
+    {
+        epoll_data_t data;
+        __u32 events;
+        __u64 id;
+    };
+
+    void close();
+    unsigned int pending() const;
+    int enter(unsigned int, unsigned int, unsigned int, const IceUtil::Time&);
+    int submit();
+    struct io_uring_sqe* getSqe();
+    void pollAdd(SOCKET, Poll&);
+    void pollRemove(Poll&);
+    void drain();
+    int reap(struct epoll_event*, int);
+
+    int _fd;
+    void* _sqRing;
+    size_t _sqRingSize;
+    void* _cqRing;
+    size_t _cqRingSize;
+    struct io_uring_sqe* _sqes;
+    size_t _sqesSize;
+
+    unsigned int _sqEntries;
+    unsigned int* _sqHead;
+    unsigned int* _sqTail;
+    unsigned int* _sqMask;
+    unsigned int* _sqArray;
+    unsigned int* _cqHead;
+    unsigned int* _cqTail;
+    unsigned int* _cqMask;
+    struct io_uring_cqe* _cqes;
+
+    bool _waiting;
+    __u64 _nextId;
+    std::map<SOCKET, Poll> _polls;
+    std::map<__u64, SOCKET> _ids;
+    std::vector<SOCKET> _rearm;
+    std::deque<std::pair<SOCKET, struct epoll_event> > _completed;
+};
+
+IoUring::IoUring(unsigned int entries) :
+    _fd(-1),
+    _sqRing(MAP_FAILED),
+    _sqRingSize(0),
+    _cqRing(MAP_FAILED),
+    _cqRingSize(0),
+    _sqes(static_cast<struct io_uring_sqe*>(MAP_FAILED)),
+    _sqesSize(0),
+    _waiting(false),
+    _nextId(1)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    _fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if(_fd < 0)
+    {
+        throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+
+    //
+    // We rely on the kernel not dropping completions and on the wait
+    // timeout argument (Linux 5.11).
+    //
+    if(!(params.features & IORING_FEAT_NODROP) || !(params.features & IORING_FEAT_EXT_ARG))
+    {
+        close();
+        throw Ice::FeatureNotSupportedException(__FILE__, __LINE__, "io_uring extended arguments");
+    }
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(__u32);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _sqRingSize = _cqRingSize = max(_sqRingSize, _cqRingSize);
+    }
+
+    _sqRing = mmap(0, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING);
+    if(_sqRing == MAP_FAILED)
+    {
+        int error = errno;
+        close();
+        throw Ice::SyscallException(__FILE__, __LINE__, error);
+    }
+
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _cqRing = _sqRing;
+    }
+    else
+    {
+        _cqRing = mmap(0, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_CQ_RING);
+        if(_cqRing == MAP_FAILED)
+        {
+            int error = errno;
+            close();
+            throw Ice::SyscallException(__FILE__, __LINE__, error);
+        }
+    }
+
+    _sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    _sqes = static_cast<struct io_uring_sqe*>(mmap(0, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                                   _fd, IORING_OFF_SQES));
+    if(_sqes == MAP_FAILED)
+    {
+        int error = errno;
+        close();
+        throw Ice::SyscallException(__FILE__, __LINE__, error);
+    }
+
+    char* sq = static_cast<char*>(_sqRing);
+    char* cq = static_cast<char*>(_cqRing);
+    _sqEntries = params.sq_entries;
+    _sqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+    _sqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+    _sqMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+    _sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+    _cqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+    _cqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+    _cqMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+IoUring::~IoUring()
+{
+    close();
+}
+
+int
+IoUring::ctl(int op, SOCKET fd, struct epoll_event* event)
+{
+    Lock sync(*this);
+    map<SOCKET, Poll>::iterator p = _polls.find(fd);
+    if(op == EPOLL_CTL_ADD)
+    {
+        if(p != _polls.end())
+        {
+            errno = EEXIST;
+            return -1;
+        }
+        p = _polls.insert(make_pair(fd, Poll())).first;
+        p->second.id = 0;
+    }
+    else if(p == _polls.end())
+    {
+        errno = ENOENT;
+        return -1;
+    }
+
+    if(p->second.id)
+    {
+        pollRemove(p->second);
+    }
+
+    //
+    // Discard the events of this file descriptor which were reaped but
+    // not returned yet, they are no longer valid.
+    //
+    for(deque<pair<SOCKET, struct epoll_event> >::iterator q = _completed.begin(); q != _completed.end();)
+    {
+        if(q->first == fd)
+        {
+            q = _completed.erase(q);
+        }
+        else
+        {
+            ++q;
+        }
+    }
+
+    if(op == EPOLL_CTL_DEL)
+    {
+        _polls.erase(p);
+
+        //
+        // Submit the removal now, the poll request holds a reference on
+        // the file which is about to be closed.
+        //
+        if(submit() < 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        p->second.data = event->data;
+        p->second.events = event->events;
+        pollAdd(fd, p->second);
+
+        //
+        // If a thread is waiting, submit the request now as it would
+        // otherwise only be submitted with the next wait.
+        //
+        if(_waiting && submit() < 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int
+IoUring::wait(struct epoll_event* events, int maxEvents, int timeout)
+{
+    IceUtil::Time deadline;
+    if(timeout > 0)
+    {
+        deadline = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::milliSeconds(timeout);
+    }
+
+    while(true)
+    {
+        bool ready;
+        unsigned int toSubmit;
+        {
+            Lock sync(*this);
+
+            //
+            // Re-arm the poll requests which completed with the previous
+            // wait, if the file descriptors are still registered.
+            //
+            for(vector<SOCKET>::const_iterator p = _rearm.begin(); p != _rearm.end(); ++p)
+            {
+                map<SOCKET, Poll>::iterator q = _polls.find(*p);
+                if(q != _polls.end() && !q->second.id)
+                {
+                    pollAdd(q->first, q->second);
+                }
+            }
+            _rearm.clear();
+            toSubmit = pending();
+
+            ready = !_completed.empty() || *_cqHead != __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+            _waiting = !ready && timeout != 0;
+        }
+
+        IceUtil::Time waitTime;
+        if(timeout > 0)
+        {
+            waitTime = deadline - IceUtil::Time::now(IceUtil::Time::Monotonic);
+            if(waitTime <= IceUtil::Time())
+            {
+                waitTime = IceUtil::Time::microSeconds(1);
+            }
+        }
+
+        int rs = enter(toSubmit, ready || timeout == 0 ? 0 : 1, 0, waitTime);
+        int error = errno;
+
+        Lock sync(*this);
+        _waiting = false;
+        if(rs < 0 && error != ETIME && error != EBUSY)
+        {
+            errno = error;
+            return -1;
+        }
+
+        int count = reap(events, maxEvents);
+
+        //
+        // Completions of removed poll requests don't return events, wait
+        // again in this case unless the timeout expired.
+        //
+        if(count > 0 || timeout == 0 ||
+           (timeout > 0 && IceUtil::Time::now(IceUtil::Time::Monotonic) >= deadline))
+        {
+            return count;
+        }
+    }
+}
+
+void
+IoUring::close()
+{
+    if(_sqes != MAP_FAILED)
+    {
+        munmap(_sqes, _sqesSize);
+    }
+    if(_cqRing != MAP_FAILED && _cqRing != _sqRing)
+    {
+        munmap(_cqRing, _cqRingSize);
+    }
+    if(_sqRing != MAP_FAILED)
+    {
+        munmap(_sqRing, _sqRingSize);
+    }
+    if(_fd >= 0)
+    {
+        closeSocketNoThrow(_fd);
+    }
+}
+
+unsigned int
+IoUring::pending() const
+{
+    //
+    // The kernel doesn't wait for completions if it submits less requests
+    // than requested so we only request the submission of the queued ones.
+    //
+    return *_sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+}
+
+int
+IoUring::enter(unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const IceUtil::Time& timeout)
+{
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    struct __kernel_timespec ts;
+    if(timeout > IceUtil::Time())
+    {
+        ts.tv_sec = timeout.toMicroSeconds() / 1000000;
+        ts.tv_nsec = (timeout.toMicroSeconds() % 1000000) * 1000;
+        arg.ts = reinterpret_cast<__u64>(&ts);
+    }
+    if(minComplete > 0)
+    {
+        flags |= IORING_ENTER_GETEVENTS;
+    }
+    return static_cast<int>(syscall(__NR_io_uring_enter, _fd, toSubmit, minComplete, flags | IORING_ENTER_EXT_ARG,
+                                    &arg, sizeof(arg)));
+}
+
+int
+IoUring::submit()
+{
+    //
+    // Called with the mutex locked. The kernel refuses new requests while
+    // completions it couldn't post to the full completion queue are
+    // pending (EBUSY) or if it's short of memory (EAGAIN). The completions
+    // are then moved to the completed list, which is returned by the next
+    // wait, to make room before trying again. They can't be left to the
+    // waiting thread since it needs the mutex to reap them.
+    //
+    while(pending() > 0)
+    {
+        if(enter(pending(), 0, 0, IceUtil::Time()) < 0)
+        {
+            if(errno == EBUSY || errno == EAGAIN)
+            {
+                drain();
+            }
+            else if(errno != EINTR)
+            {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+struct io_uring_sqe*
+IoUring::getSqe()
+{
+    //
+    // If the submission queue is full, submit the queued requests.
+    //
+    if(*_sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries && submit() < 0)
+    {
+        throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+
+    unsigned int tail = *_sqTail;
+    unsigned int index = tail & *_sqMask;
+    struct io_uring_sqe* sqe = &_sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    _sqArray[index] = index;
+    return sqe;
+}
+
+void
+IoUring::pollAdd(SOCKET fd, Poll& poll)
+{
+    struct io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = poll.events;
+    sqe->user_data = poll.id = _nextId++;
+    _ids.insert(make_pair(poll.id, fd));
+    __atomic_store_n(_sqTail, *_sqTail + 1, __ATOMIC_RELEASE);
+}
+
+void
+IoUring::pollRemove(Poll& poll)
+{
+    //
+    // The completion of the removal request and the cancelled poll
+    // request are ignored by reap since their identifiers are unknown.
+    //
+    struct io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = poll.id;
+    sqe->user_data = 0;
+    _ids.erase(poll.id);
+    poll.id = 0;
+    __atomic_store_n(_sqTail, *_sqTail + 1, __ATOMIC_RELEASE);
+}
+
+void
+IoUring::drain()
+{
+    //
+    // Move the completions of the poll requests to the completed list and
+    // free the completion queue.
+    //
+    unsigned int head = *_cqHead;
+    unsigned int tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+    while(head != tail)
+    {
+        struct io_uring_cqe& cqe = _cqes[head & *_cqMask];
+        ++head;
+
+        map<__u64, SOCKET>::iterator p = _ids.find(cqe.user_data);
+        if(p == _ids.end())
+        {
+            continue;
+        }
+
+        map<SOCKET, Poll>::iterator q = _polls.find(p->second);
+        assert(q != _polls.end() && q->second.id == cqe.user_data);
+        _ids.erase(p);
+        q->second.id = 0;
+
+        struct epoll_event event;
+        event.data = q->second.data;
+        event.events = cqe.res < 0 ? static_cast<__u32>(EPOLLERR) : static_cast<__u32>(cqe.res);
+        _completed.push_back(make_pair(q->first, event));
+    }
+    __atomic_store_n(_cqHead, head, __ATOMIC_RELEASE);
+}
+
+int
+IoUring::reap(struct epoll_event* events, int maxEvents)
+{
+    drain();
+
+    //
+    // The poll requests are re-armed with the next wait once their event
+    // is returned.
+    //
+    int count = 0;
+    while(!_completed.empty() && count < maxEvents)
+    {
+        _rearm.push_back(_completed.front().first);
+        events[count++] = _completed.front().second;
+        _completed.pop_front();
+    }
+    return count;
+}
+
+#endif
+
 Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrupted(false)
 {
     SOCKET fds[2];
@@ -251,6 +731,9 @@ Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrup
     _selecting = false;
 
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+    _uring = 0;
+#   endif
     _events.resize(256);
     _queueFd = epoll_create(1);
     if(_queueFd < 0)
@@ -262,7 +745,7 @@ Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrup
     memset(&event, 0, sizeof(epoll_event));
     event.data.ptr = 0;
     event.events = EPOLLIN;
-    if(epoll_ctl(_queueFd, EPOLL_CTL_ADD, _fdIntrRead, &event) != 0)
+    if(epollCtl(EPOLL_CTL_ADD, _fdIntrRead, &event) != 0)
     {
         Ice::Error out(_instance->initializationData().logger);
         out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
@@ -300,18 +783,70 @@ Selector::~Selector()
 {
 }
 
+#if defined(ICE_USE_IO_URING)
 void
-Selector::destroy()
+Selector::setup(const string& backend)
 {
-#if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
+    if(backend != "uring")
+    {
+        return;
+    }
+
     try
     {
-        closeSocket(_queueFd);
+        _uring = new IoUring(static_cast<unsigned int>(_events.size()));
     }
     catch(const Ice::LocalException& ex)
+    {
+        //
+        // Fallback to epoll if the kernel doesn't support io_uring.
+        //
+        if(_instance->traceLevels()->threadPool >= 1)
+        {
+            Ice::Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+            out << "io_uring is not supported, using epoll:\n" << ex;
+        }
+        return;
+    }
+
+    epoll_event event;
+    memset(&event, 0, sizeof(epoll_event));
+    event.data.ptr = 0;
+    event.events = EPOLLIN;
+    if(_uring->ctl(EPOLL_CTL_ADD, _fdIntrRead, &event) != 0)
     {
         Ice::Error out(_instance->initializationData().logger);
-        out << "exception in selector while calling closeSocket():\n" << ex;
+        out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+    }
+
+    //
+    // The epoll FD is no longer used.
+    //
+    closeSocketNoThrow(_queueFd);
+    _queueFd = INVALID_SOCKET;
+}
+#endif
+
+void
+Selector::destroy()
+{
+#if defined(ICE_USE_IO_URING)
+    delete _uring;
+    _uring = 0;
+#endif
+
+#if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
+    if(_queueFd != INVALID_SOCKET)
+    {
+        try
+        {
+            closeSocket(_queueFd);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            Ice::Error out(_instance->initializationData().logger);
+            out << "exception in selector while calling closeSocket():\n" << ex;
+        }
     }
 #endif
 
@@ -388,7 +923,7 @@ Selector::enable(EventHandler* handler, SocketOperation status)
         {
             event.events |= EPOLLOUT;
         }
-        if(epoll_ctl(_queueFd, previous ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event) != 0)
+        if(epollCtl(previous ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event) != 0)
         {
             Ice::Error out(_instance->initializationData().logger);
             out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
@@ -441,7 +976,7 @@ Selector::disable(EventHandler* handler, SocketOperation status)
         {
             event.events |= EPOLLOUT;
         }
-        if(epoll_ctl(_queueFd, newStatus ? EPOLL_CTL_MOD : EPOLL_CTL_DEL, fd, &event) != 0)
+        if(epollCtl(newStatus ? EPOLL_CTL_MOD : EPOLL_CTL_DEL, fd, &event) != 0)
         {
             Ice::Error out(_instance->initializationData().logger);
             out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
@@ -721,7 +1256,16 @@ Selector::select(int timeout)
     while(true)
     {
 #if defined(ICE_USE_EPOLL)
-        _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+#   if defined(ICE_USE_IO_URING)
+        if(_uring)
+        {
+            _count = _uring->wait(&_events[0], static_cast<int>(_events.size()), timeout);
+        }
+        else
+#   endif
+        {
+            _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+        }
 #elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
         if(timeout >= 0)
@@ -972,7 +1516,7 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
     {
         op = EPOLL_CTL_MOD;
     }
-    if(epoll_ctl(_queueFd, op, fd, &event) != 0)
+    if(epollCtl(op, fd, &event) != 0)
     {
         Ice::Error out(_instance->initializationData().logger);
         out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
@@ -1017,6 +1561,20 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
     checkReady(handler);
 }
 
+#if defined(ICE_USE_EPOLL)
+int
+Selector::epollCtl(int op, SOCKET fd, struct epoll_event* event)
+{
+#   if defined(ICE_USE_IO_URING)
+    if(_uring)
+    {
+        return _uring->ctl(op, fd, event);
+    }
+#   endif
+    return epoll_ctl(_queueFd, op, fd, event);
+}
+#endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
@@ -16,6 +16,15 @@
 
 #if defined(ICE_USE_EPOLL)
 #   include <sys/epoll.h>
+#   if !defined(ICE_NO_IO_URING) && defined(__has_include)
+#      if __has_include(<linux/io_uring.h>)
+#         include <linux/io_uring.h>
+#         include <sys/syscall.h>
+#         if defined(IORING_ENTER_EXT_ARG) && defined(__NR_io_uring_setup)
+#            define ICE_USE_IO_URING 1
+#         endif
+#      endif
+#   endif
 #elif defined(ICE_USE_KQUEUE)
 #   include <sys/event.h>
 #elif defined(ICE_USE_IOCP)
@@ -106,6 +115,10 @@ private:
 
 #elif defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_SELECT) || defined(ICE_USE_POLL)
 
+#if defined(ICE_USE_IO_URING)
+class IoUring;
+#endif
+
 class Selector
 {
 public:
@@ -113,6 +126,9 @@ public:
     Selector(const InstancePtr&);
     ~Selector();
 
+#if defined(ICE_USE_IO_URING)
+    void setup(const std::string&);
+#endif
     void destroy();
 
     void initialize(EventHandler*)
@@ -136,6 +152,9 @@ private:
     void checkReady(EventHandler*);
     void updateSelector();
     void updateSelectorForEventHandler(EventHandler*, SocketOperation, SocketOperation);
+#if defined(ICE_USE_EPOLL)
+    int epollCtl(int, SOCKET, struct epoll_event*);
+#endif
 
     const InstancePtr _instance;
 
@@ -150,6 +169,9 @@ private:
 #if defined(ICE_USE_EPOLL)
     std::vector<struct epoll_event> _events;
     int _queueFd;
+#   if defined(ICE_USE_IO_URING)
+    IoUring* _uring;
+#   endif
 #elif defined(ICE_USE_KQUEUE)
     std::vector<struct kevent> _events;
     std::vector<struct kevent> _changes;
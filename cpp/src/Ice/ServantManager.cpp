@@ -15,23 +15,50 @@ using namespace IceInternal;
 
 ICE_API IceUtil::Shared* IceInternal::upCast(ServantManager* p) { return p; }
 
+size_t
+IceInternal::ServantManager::IdentityHash::operator()(const Identity& ident) const
+{
+    //
+    // FNV-1a hash of the identity name and category.
+    //
+    size_t h = 2166136261U;
+    for(string::const_iterator p = ident.name.begin(); p != ident.name.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    h = (h ^ '/') * 16777619U;
+    for(string::const_iterator p = ident.category.begin(); p != ident.category.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return h;
+}
+
+IceInternal::ServantManager::Shard&
+IceInternal::ServantManager::shard(const Identity& ident) const
+{
+    //
+    // Use the 5 high bits of the mixed hash to select one of the 32 shards,
+    // the hash map of the shard uses the low bits to select the bucket.
+    //
+    unsigned int h = static_cast<unsigned int>(IdentityHash()(ident)) * 0x9E3779B1U;
+    return _shards[(h >> 27) & (shardCount - 1)];
+}
+
 void
 IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity& ident, const string& facet)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::ReadLock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    Shard& s = shard(ident);
+    SharedMutex::Lock shardSync(s.mutex);
 
-    if(p == _servantMapMap.end())
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
+    if(p == s.servantMapMap.end())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        p = s.servantMapMap.insert(pair<const Identity, FacetMap>(ident, FacetMap())).first;
     }
     else
     {
@@ -48,15 +75,13 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
         }
     }
 
-    _servantMapMapHint = p;
-
     p->second.insert(pair<const string, ObjectPtr>(facet, object));
 }
 
 void
 IceInternal::ServantManager::addDefaultServant(const ObjectPtr& object, const string& category)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::Lock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
@@ -79,19 +104,17 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
     //
     ObjectPtr servant = 0;
 
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::ReadLock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    Shard& s = shard(ident);
+    SharedMutex::Lock shardSync(s.mutex);
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
+    FacetMap::iterator q;
 
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(p == s.servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         ToStringMode toStringMode = _instance->toStringMode();
         ostringstream os;
@@ -108,15 +131,7 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     if(p->second.empty())
     {
-        if(p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        s.servantMapMap.erase(p);
     }
     return servant;
 }
@@ -131,7 +146,7 @@ IceInternal::ServantManager::removeDefaultServant(const string& category)
     //
     ObjectPtr servant = 0;
 
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::Lock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
@@ -150,75 +165,58 @@ IceInternal::ServantManager::removeDefaultServant(const string& category)
 FacetMap
 IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::ReadLock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    Shard& s = shard(ident);
+    SharedMutex::Lock shardSync(s.mutex);
 
-    if(p == _servantMapMap.end())
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
+    if(p == s.servantMapMap.end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant",
                                      Ice::identityToString(ident, _instance->toStringMode()));
     }
 
-    FacetMap result = p->second;
-
-    if(p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
-
+    FacetMap result;
+    result.swap(p->second);
+    s.servantMapMap.erase(p);
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method doesn't check whether the servant manager is destroyed,
+    // it might be called if requests are received over a bidir connection
+    // after the adapter was deactivated.
     //
-    //assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        const Shard& s = shard(ident);
+        SharedMutex::ReadLock sync(s.mutex);
+
+        ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
+        if(p != s.servantMapMap.end())
+        {
+            FacetMap::const_iterator q = p->second.find(facet);
+            if(q != p->second.end())
+            {
+                return q->second;
+            }
+        }
     }
 
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    SharedMutex::ReadLock sync(_mutex);
+
+    DefaultServantMap::const_iterator d = _defaultServantMap.find(ident.category);
+    if(d == _defaultServantMap.end())
     {
-        DefaultServantMap::const_iterator d = _defaultServantMap.find(ident.category);
+        d = _defaultServantMap.find("");
         if(d == _defaultServantMap.end())
         {
-            d = _defaultServantMap.find("");
-            if(d == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return d->second;
-            }
+            return 0;
         }
         else
         {
@@ -227,15 +225,14 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return d->second;
     }
 }
 
 ObjectPtr
 IceInternal::ServantManager::findDefaultServant(const string& category) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::ReadLock sync(_mutex);
 
     DefaultServantMap::const_iterator p = _defaultServantMap.find(category);
     if(p == _defaultServantMap.end())
@@ -251,26 +248,20 @@ IceInternal::ServantManager::findDefaultServant(const string& category) const
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::ReadLock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    const Shard& s = shard(ident);
+    SharedMutex::ReadLock shardSync(s.mutex);
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
+    ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
+    if(p == s.servantMapMap.end())
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
         return p->second;
     }
 }
@@ -278,31 +269,21 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method doesn't check whether the servant manager is destroyed,
+    // it might be called if requests are received over a bidir connection
+    // after the adapter was deactivated.
     //
-    //assert(_instance); // Must not be called after destruction.
+    const Shard& s = shard(ident);
+    SharedMutex::ReadLock sync(s.mutex);
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
+    ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
+    if(p == s.servantMapMap.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
         assert(!p->second.empty());
         return true;
     }
@@ -311,40 +292,26 @@ IceInternal::ServantManager::hasServant(const Identity& ident) const
 void
 IceInternal::ServantManager::addServantLocator(const ServantLocatorPtr& locator, const string& category)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::Lock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    if((_locatorMapHint != _locatorMap.end() && _locatorMapHint->first == category)
-       || _locatorMap.find(category) != _locatorMap.end())
+    if(_locatorMap.find(category) != _locatorMap.end())
     {
         throw AlreadyRegisteredException(__FILE__, __LINE__, "servant locator", category);
     }
 
-    _locatorMapHint = _locatorMap.insert(_locatorMapHint, pair<const string, ServantLocatorPtr>(category, locator));
+    _locatorMap.insert(pair<const string, ServantLocatorPtr>(category, locator));
 }
 
 ServantLocatorPtr
 IceInternal::ServantManager::removeServantLocator(const string& category)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::Lock sync(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>::iterator p = _locatorMap.end();
-    if(_locatorMapHint != p)
-    {
-        if(_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if(p == _locatorMap.end())
-    {
-        p = _locatorMap.find(category);
-    }
-
+    map<string, ServantLocatorPtr>::iterator p = _locatorMap.find(category);
     if(p == _locatorMap.end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant locator", category);
@@ -352,14 +319,13 @@ IceInternal::ServantManager::removeServantLocator(const string& category)
 
     ServantLocatorPtr locator = p->second;
     _locatorMap.erase(p);
-    _locatorMapHint = _locatorMap.begin();
     return locator;
 }
 
 ServantLocatorPtr
 IceInternal::ServantManager::findServantLocator(const string& category) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    SharedMutex::ReadLock sync(_mutex);
 
     //
     // This assert is not valid if the adapter dispatch incoming
@@ -369,26 +335,9 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
     //
     //assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>& locatorMap =
-        const_cast<map<string, ServantLocatorPtr>&>(_locatorMap);
-
-    map<string, ServantLocatorPtr>::iterator p = locatorMap.end();
-    if(_locatorMapHint != locatorMap.end())
-    {
-        if(_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if(p == locatorMap.end())
+    map<string, ServantLocatorPtr>::const_iterator p = _locatorMap.find(category);
+    if(p != _locatorMap.end())
     {
-        p = locatorMap.find(category);
-    }
-
-    if(p != locatorMap.end())
-    {
-        _locatorMapHint = p;
         return p->second;
     }
     else
@@ -399,9 +348,7 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
 
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
-      _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
-      _locatorMapHint(_locatorMap.end())
+      _adapterName(adapterName)
 {
 }
 
@@ -418,13 +365,13 @@ IceInternal::ServantManager::~ServantManager()
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    vector<ServantMapMap> servantMapMaps(shardCount);
     DefaultServantMap defaultServantMap;
     map<string, ServantLocatorPtr> locatorMap;
     Ice::LoggerPtr logger;
 
     {
-        IceUtil::Mutex::Lock sync(*this);
+        SharedMutex::Lock sync(_mutex);
         //
         // If the ServantManager has already been destroyed, we're done.
         //
@@ -435,13 +382,15 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        for(size_t i = 0; i < shardCount; ++i)
+        {
+            SharedMutex::Lock shardSync(_shards[i].mutex);
+            servantMapMaps[i].swap(_shards[i].servantMapMap);
+        }
 
         defaultServantMap.swap(_defaultServantMap);
 
         locatorMap.swap(_locatorMap);
-        _locatorMapHint = _locatorMap.end();
 
         _instance = 0;
     }
@@ -474,7 +423,7 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
+    servantMapMaps.clear();
     locatorMap.clear();
     defaultServantMap.clear();
 }
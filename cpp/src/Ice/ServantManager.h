@@ -6,13 +6,17 @@
 #define ICE_SERVANT_MANAGER_H
 
 #include <IceUtil/Shared.h>
-#include <IceUtil/Mutex.h>
+#include <Ice/SharedMutex.h>
 #include <Ice/ServantManagerF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ServantLocatorF.h>
 #include <Ice/Identity.h>
 #include <Ice/FacetMap.h>
 
+#ifdef ICE_CPP11_COMPILER
+#   include <unordered_map>
+#endif
+
 namespace Ice
 {
 
@@ -23,7 +27,7 @@ class ObjectAdapterI;
 namespace IceInternal
 {
 
-class ServantManager : public IceUtil::Shared, public IceUtil::Mutex
+class ServantManager : public IceUtil::Shared
 {
 public:
 
@@ -48,20 +52,46 @@ private:
     void destroy();
     friend class Ice::ObjectAdapterI;
 
+    //
+    // The active servant map is split into shards, each protected by its
+    // own reader-writer mutex. Dispatch threads looking up servants only
+    // acquire the mutex of the identity's shard for reading and never block
+    // each other. The other members are protected by _mutex, which must be
+    // acquired before the mutex of a shard.
+    //
+    struct IdentityHash
+    {
+        size_t operator()(const Ice::Identity&) const;
+    };
+
+#ifdef ICE_CPP11_COMPILER
+    typedef std::unordered_map<Ice::Identity, Ice::FacetMap, IdentityHash> ServantMapMap;
+#else
+    typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
+#endif
+    typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
+
+    struct Shard
+    {
+        SharedMutex mutex;
+        ServantMapMap servantMapMap;
+    };
+
+    static const size_t shardCount = 32; // Must be a power of two.
+
+    Shard& shard(const Ice::Identity&) const;
+
+    SharedMutex _mutex;
+
     InstancePtr _instance;
 
     const std::string _adapterName;
 
-    typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
-    typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
-
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    mutable Shard _shards[shardCount];
 
     DefaultServantMap _defaultServantMap;
 
     std::map<std::string, Ice::ServantLocatorPtr> _locatorMap;
-    mutable std::map<std::string, Ice::ServantLocatorPtr>::iterator _locatorMapHint;
 };
 
 }
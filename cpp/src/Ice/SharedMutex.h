@@ -0,0 +1,160 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_SHARED_MUTEX_H
+#define ICE_SHARED_MUTEX_H
+
+#include <IceUtil/Config.h>
+#include <IceUtil/Lock.h>
+#include <IceUtil/ThreadException.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#   include <errno.h>
+#endif
+
+namespace IceInternal
+{
+
+//
+// A non-recursive reader-writer mutex. Readers don't block each other,
+// writers have exclusive access. Lock acquires the mutex for writing and
+// ReadLock for reading.
+//
+class SharedMutex : private IceUtil::noncopyable
+{
+public:
+
+    typedef IceUtil::LockT<SharedMutex> Lock;
+
+    class ReadLock : private IceUtil::noncopyable
+    {
+    public:
+
+        ReadLock(const SharedMutex& mutex) :
+            _mutex(mutex)
+        {
+            _mutex.readLock();
+        }
+
+        ~ReadLock()
+        {
+            _mutex.readUnlock();
+        }
+
+    private:
+
+        const SharedMutex& _mutex;
+    };
+
+    SharedMutex()
+    {
+#ifdef _WIN32
+        InitializeSRWLock(&_lock);
+#else
+        pthread_rwlockattr_t attr;
+        int rc = pthread_rwlockattr_init(&attr);
+        if(rc != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, rc);
+        }
+#   if defined(__GLIBC__)
+        //
+        // Prefer writers, glibc prefers readers by default and a writer
+        // might otherwise never acquire a mutex that is constantly
+        // acquired by readers.
+        //
+        pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#   endif
+        rc = pthread_rwlock_init(&_lock, &attr);
+        pthread_rwlockattr_destroy(&attr);
+        if(rc != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, rc);
+        }
+#endif
+    }
+
+    ~SharedMutex()
+    {
+#ifndef _WIN32
+#   ifndef NDEBUG
+        int rc = pthread_rwlock_destroy(&_lock);
+        assert(rc == 0);
+#   else
+        pthread_rwlock_destroy(&_lock);
+#   endif
+#endif
+    }
+
+    void lock() const
+    {
+#ifdef _WIN32
+        AcquireSRWLockExclusive(&_lock);
+#else
+        int rc = pthread_rwlock_wrlock(&_lock);
+        if(rc != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, rc);
+        }
+#endif
+    }
+
+    bool tryLock() const
+    {
+#ifdef _WIN32
+        return TryAcquireSRWLockExclusive(&_lock) != 0;
+#else
+        int rc = pthread_rwlock_trywrlock(&_lock);
+        if(rc != 0 && rc != EBUSY)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, rc);
+        }
+        return rc == 0;
+#endif
+    }
+
+    void unlock() const
+    {
+#ifdef _WIN32
+        ReleaseSRWLockExclusive(&_lock);
+#else
+        pthread_rwlock_unlock(&_lock);
+#endif
+    }
+
+    void readLock() const
+    {
+#ifdef _WIN32
+        AcquireSRWLockShared(&_lock);
+#else
+        int rc = pthread_rwlock_rdlock(&_lock);
+        if(rc != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, rc);
+        }
+#endif
+    }
+
+    void readUnlock() const
+    {
+#ifdef _WIN32
+        ReleaseSRWLockShared(&_lock);
+#else
+        pthread_rwlock_unlock(&_lock);
+#endif
+    }
+
+private:
+
+#ifdef _WIN32
+    mutable SRWLOCK _lock;
+#else
+    mutable pthread_rwlock_t _lock;
+#endif
+};
+
+}
+
+#endif
@@ -6,6 +6,11 @@
 #include <Ice/NetworkProxy.h>
 #include <Ice/ProtocolInstance.h>
 
+#if !defined(_WIN32)
+#   include <sys/uio.h>
+#   include <limits.h>
+#endif
+
 using namespace IceInternal;
 
 #if defined(ICE_OS_UWP)
@@ -222,6 +227,117 @@ StreamSocket::write(Buffer& buf)
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+SocketOperation
+StreamSocket::writev(const std::vector<Buffer*>& buffers)
+{
+#if defined(_WIN32)
+    for(std::vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        if((*p)->i != (*p)->b.end() && write(**p) != SocketOperationNone)
+        {
+            return SocketOperationWrite;
+        }
+    }
+    return SocketOperationNone;
+#else
+    if(_state == StateProxyWrite)
+    {
+        //
+        // The proxy handshake writes from a single buffer.
+        //
+        for(std::vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+        {
+            if((*p)->i != (*p)->b.end() && write(**p) != SocketOperationNone)
+            {
+                return SocketOperationWrite;
+            }
+        }
+        return SocketOperationNone;
+    }
+
+    assert(_fd != INVALID_SOCKET);
+
+#   ifdef IOV_MAX
+    const size_t maxIov = IOV_MAX < 64 ? IOV_MAX : 64;
+#   else
+    const size_t maxIov = 16;
+#   endif
+    struct iovec iov[64];
+
+    std::vector<Buffer*>::const_iterator first = buffers.begin();
+    while(true)
+    {
+        //
+        // Skip the buffers which are already fully written and gather the
+        // remaining data of the next buffers into the I/O vector.
+        //
+        while(first != buffers.end() && (*first)->i == (*first)->b.end())
+        {
+            ++first;
+        }
+        if(first == buffers.end())
+        {
+            return SocketOperationNone;
+        }
+
+        int count = 0;
+        for(std::vector<Buffer*>::const_iterator p = first; p != buffers.end() && static_cast<size_t>(count) < maxIov;
+            ++p)
+        {
+            if((*p)->i != (*p)->b.end())
+            {
+                iov[count].iov_base = &*(*p)->i;
+                iov[count].iov_len = static_cast<size_t>((*p)->b.end() - (*p)->i);
+                ++count;
+            }
+        }
+
+        ssize_t ret = ::writev(_fd, iov, count);
+        if(ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if(connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        //
+        // Advance the buffers by the number of bytes written.
+        //
+        size_t sent = static_cast<size_t>(ret);
+        for(std::vector<Buffer*>::const_iterator p = first; p != buffers.end() && sent > 0; ++p)
+        {
+            size_t length = static_cast<size_t>((*p)->b.end() - (*p)->i);
+            if(sent < length)
+            {
+                (*p)->i += sent;
+                break;
+            }
+            (*p)->i = (*p)->b.end();
+            sent -= length;
+        }
+    }
+#endif
+}
+
 #if !defined(ICE_OS_UWP)
 ssize_t
 StreamSocket::read(char* buf, size_t length)
@@ -49,6 +49,12 @@ IceInternal::TcpTransceiver::write(Buffer& buf)
     return _stream->write(buf);
 }
 
+SocketOperation
+IceInternal::TcpTransceiver::writev(const std::vector<Buffer*>& buffers)
+{
+    return _stream->writev(buffers);
+}
+
 SocketOperation
 IceInternal::TcpTransceiver::read(Buffer& buf)
 {
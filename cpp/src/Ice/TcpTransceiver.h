@@ -27,6 +27,7 @@ public:
 
     virtual void close();
     virtual SocketOperation write(Buffer&);
+    virtual SocketOperation writev(const std::vector<Buffer*>&);
     virtual SocketOperation read(Buffer&);
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
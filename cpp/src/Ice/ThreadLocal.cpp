@@ -0,0 +1,71 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/ThreadLocal.h>
+
+using namespace IceInternal;
+
+namespace
+{
+
+#ifdef _WIN32
+void WINAPI
+deleteValue(void* value)
+{
+    delete static_cast<ThreadLocalBase::Value*>(value);
+}
+#else
+extern "C" void
+deleteValue(void* value)
+{
+    delete static_cast<ThreadLocalBase::Value*>(value);
+}
+#endif
+
+}
+
+IceInternal::ThreadLocalBase::Value::~Value()
+{
+}
+
+IceInternal::ThreadLocalBase::ThreadLocalBase()
+{
+#ifdef _WIN32
+    _key = FlsAlloc(&deleteValue);
+#else
+    _keyCreated = pthread_key_create(&_key, &deleteValue) == 0;
+#endif
+}
+
+IceInternal::ThreadLocalBase::~ThreadLocalBase()
+{
+    resetValue();
+}
+
+IceInternal::ThreadLocalBase::Value*
+IceInternal::ThreadLocalBase::getValue() const
+{
+#ifdef _WIN32
+    return _key == FLS_OUT_OF_INDEXES ? 0 : static_cast<Value*>(FlsGetValue(_key));
+#else
+    return _keyCreated ? static_cast<Value*>(pthread_getspecific(_key)) : 0;
+#endif
+}
+
+bool
+IceInternal::ThreadLocalBase::setValue(Value* value)
+{
+#ifdef _WIN32
+    return _key != FLS_OUT_OF_INDEXES && FlsSetValue(_key, value);
+#else
+    return _keyCreated && pthread_setspecific(_key, value) == 0;
+#endif
+}
+
+void
+IceInternal::ThreadLocalBase::resetValue()
+{
+    delete getValue();
+    setValue(0);
+}
@@ -0,0 +1,101 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_THREAD_LOCAL_H
+#define ICE_THREAD_LOCAL_H
+
+#include <IceUtil/Config.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+namespace IceInternal
+{
+
+//
+// The key of a thread local value. Windows uses fiber local storage, its
+// destructor callback is also called when a thread exits.
+//
+class ThreadLocalBase : private IceUtil::noncopyable
+{
+public:
+
+    class Value
+    {
+    public:
+
+        virtual ~Value();
+    };
+
+protected:
+
+    ThreadLocalBase();
+    ~ThreadLocalBase();
+
+    Value* getValue() const;
+    bool setValue(Value*);
+    void resetValue();
+
+private:
+
+#ifdef _WIN32
+    DWORD _key;
+#else
+    bool _keyCreated;
+    pthread_key_t _key;
+#endif
+};
+
+//
+// A value of each thread, default constructed on first use and deleted when
+// the thread exits. The values of the threads still running when it's
+// destroyed are leaked, except the value of the destroying thread (the main
+// thread for a static ThreadLocal).
+//
+template<typename T> class ThreadLocal : public ThreadLocalBase
+{
+public:
+
+    //
+    // Returns the value of the calling thread. The value is created if it
+    // doesn't exist yet and create is true, null is returned otherwise or
+    // if it can't be created.
+    //
+    T* get(bool create)
+    {
+        Holder* holder = static_cast<Holder*>(getValue());
+        if(!holder && create)
+        {
+            holder = new Holder;
+            if(!setValue(holder))
+            {
+                delete holder;
+                return 0;
+            }
+        }
+        return holder ? &holder->value : 0;
+    }
+
+    //
+    // Delete the value of the calling thread.
+    //
+    void reset()
+    {
+        resetValue();
+    }
+
+private:
+
+    class Holder : public Value
+    {
+    public:
+
+        T value;
+    };
+};
+
+}
+
+#endif
@@ -12,11 +12,21 @@
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Properties.h>
 #include <Ice/TraceLevels.h>
+#include <IceUtil/StringUtil.h>
 
 #if defined(ICE_OS_UWP)
 #   include <Ice/StringConverter.h>
 #endif
 
+#if defined(__linux__)
+#   include <fstream>
+#   include <sched.h>
+#endif
+
+#ifndef ICE_CPP11_COMPILER_HAS_ATOMIC
+#   include <deque>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -27,6 +37,53 @@ ICE_API IceUtil::Shared* IceInternal::upCast(ThreadPool* p) { return p; }
 namespace
 {
 
+//
+// Parses a list of CPUs such as "0-3,8,10-11". Returns false if the list
+// is invalid.
+//
+bool
+parseCpuList(const string& str, vector<int>& cpus)
+{
+    vector<string> ranges;
+    if(!IceUtilInternal::splitString(str, ", \t\n", ranges) || ranges.empty())
+    {
+        return false;
+    }
+
+    for(vector<string>::const_iterator p = ranges.begin(); p != ranges.end(); ++p)
+    {
+        string::size_type pos = p->find('-');
+        int first;
+        int last;
+        istringstream is1(p->substr(0, pos));
+        if(!(is1 >> first) || !is1.eof() || first < 0)
+        {
+            return false;
+        }
+        if(pos == string::npos)
+        {
+            last = first;
+        }
+        else
+        {
+            istringstream is2(p->substr(pos + 1));
+            if(!(is2 >> last) || !is2.eof() || last < first)
+            {
+                return false;
+            }
+        }
+
+        for(int cpu = first; cpu <= last; ++cpu)
+        {
+            if(find(cpus.begin(), cpus.end(), cpu) == cpus.end())
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return true;
+}
+
 class ShutdownWorkItem : public ThreadPoolWorkItem
 {
 public:
@@ -110,6 +167,13 @@ class ThreadPoolDestroyedException
 {
 };
 
+//
+// The capacity of the dispatch queue of a work-stealing worker, this
+// must be a power of two. The IO thread dispatches the message itself
+// if the queues of all the workers are full.
+//
+const size_t dispatchWorkerCapacity = 1024;
+
 #ifdef ICE_SWIFT
 string
 prefixToDispatchQueueLabel(const std::string& prefix)
@@ -266,6 +330,279 @@ IceInternal::ThreadPoolWorkQueue::getNativeInfo()
     return 0;
 }
 
+//
+// A work-stealing dispatch worker. The IO threads push dispatches to
+// the queue of a worker and idle workers steal dispatches from the
+// queues of busy workers. The queue is a bounded multi-producer and
+// multi-consumer ring buffer where each cell carries a sequence number
+// to synchronize producers and consumers without locks.
+//
+class IceInternal::ThreadPool::DispatchWorker : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    struct Dispatch
+    {
+        Dispatch() : operation(SocketOperationNone)
+        {
+        }
+
+        Dispatch(const DispatchWorkItemPtr& w, const EventHandlerPtr& h, SocketOperation op) :
+            workItem(w), handler(h), operation(op)
+        {
+        }
+
+        DispatchWorkItemPtr workItem;
+        EventHandlerPtr handler;
+        SocketOperation operation;
+    };
+
+    DispatchWorker(const ThreadPoolPtr& pool, const string& name, size_t index, size_t capacity) :
+        _index(index),
+#ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
+        _cells(capacity),
+        _mask(capacity - 1),
+        _enqueuePos(0),
+        _dequeuePos(0),
+#else
+        _capacity(capacity),
+#endif
+        _sleeping(0),
+        _destroyed(false),
+        _started(false)
+    {
+#ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
+        assert((capacity & _mask) == 0);
+        for(size_t i = 0; i < capacity; ++i)
+        {
+            _cells[i].sequence.store(i, memory_order_relaxed);
+        }
+#endif
+        _thread = new EventHandlerThread(pool, name, this);
+    }
+
+    size_t
+    index() const
+    {
+        return _index;
+    }
+
+    const EventHandlerThreadPtr&
+    thread() const
+    {
+        return _thread;
+    }
+
+    void
+    start(size_t stackSize, bool hasPriority, int priority)
+    {
+        if(hasPriority)
+        {
+            _thread->start(stackSize, priority);
+        }
+        else
+        {
+            _thread->start(stackSize);
+        }
+        _started = true;
+    }
+
+    void
+    join()
+    {
+        if(_started)
+        {
+            _thread->getThreadControl().join();
+        }
+    }
+
+    bool
+    push(const Dispatch& dispatch)
+    {
+#ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
+        Cell* cell;
+        size_t pos = _enqueuePos.load(memory_order_relaxed);
+        while(true)
+        {
+            cell = &_cells[pos & _mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            if(seq == pos)
+            {
+                //
+                // The new position is stored with sequential consistency, see
+                // wakeUp() and waitForDispatches().
+                //
+                if(_enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_seq_cst, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(seq < pos)
+            {
+                return false; // Full
+            }
+            else
+            {
+                pos = _enqueuePos.load(memory_order_relaxed);
+            }
+        }
+        cell->dispatch = dispatch;
+        cell->sequence.store(pos + 1, memory_order_release);
+#else
+        IceUtil::Mutex::Lock sync(_queueMutex);
+        if(_queue.size() == _capacity)
+        {
+            return false;
+        }
+        _queue.push_back(dispatch);
+#endif
+        return true;
+    }
+
+    bool
+    pop(Dispatch& dispatch)
+    {
+#ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
+        Cell* cell;
+        size_t pos = _dequeuePos.load(memory_order_relaxed);
+        while(true)
+        {
+            cell = &_cells[pos & _mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            if(seq == pos + 1)
+            {
+                if(_dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(seq < pos + 1)
+            {
+                return false; // Empty
+            }
+            else
+            {
+                pos = _dequeuePos.load(memory_order_relaxed);
+            }
+        }
+        dispatch = cell->dispatch;
+        cell->dispatch = Dispatch();
+        cell->sequence.store(pos + _mask + 1, memory_order_release);
+#else
+        IceUtil::Mutex::Lock sync(_queueMutex);
+        if(_queue.empty())
+        {
+            return false;
+        }
+        dispatch = _queue.front();
+        _queue.pop_front();
+#endif
+        return true;
+    }
+
+    size_t
+    depth() const
+    {
+#ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
+        size_t dequeuePos = _dequeuePos.load(memory_order_relaxed);
+        size_t enqueuePos = _enqueuePos.load(memory_order_seq_cst);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+#else
+        IceUtil::Mutex::Lock sync(_queueMutex);
+        return _queue.size();
+#endif
+    }
+
+    //
+    // Wake up the worker if it's waiting for dispatches. The producer
+    // stores the enqueue position and then loads _sleeping, the worker
+    // stores _sleeping and then loads the enqueue positions. All these
+    // operations are sequentially consistent so the worker either sees
+    // the dispatch pushed before this call or gets notified. Without
+    // std::atomic, the queue mutex and the full barriers of the
+    // IceUtilInternal::Atomic operations provide the same guarantee.
+    //
+    bool
+    wakeUp(bool force)
+    {
+        if((force ? _sleeping.fetch_add(0) : _sleeping.load()) == 0)
+        {
+            return false;
+        }
+        Lock sync(*this);
+        notify();
+        return true;
+    }
+
+    //
+    // Wait for dispatches, returns false if the worker is destroyed
+    // and there are no more dispatches to run.
+    //
+    bool
+    waitForDispatches(const ThreadPool& pool)
+    {
+        Lock sync(*this);
+        _sleeping.exchange(1);
+        if(pool.hasQueuedDispatches())
+        {
+            _sleeping.exchange(0);
+            return true;
+        }
+        else if(_destroyed)
+        {
+            return false;
+        }
+
+        _thread->setState(ICE_ENUM(ThreadState, ThreadStateIdle));
+        wait();
+        _sleeping.exchange(0);
+        _thread->setState(ICE_ENUM(ThreadState, ThreadStateInUseForUser));
+        return true;
+    }
+
+    void
+    destroy()
+    {
+        Lock sync(*this);
+        _destroyed = true;
+        notify();
+    }
+
+    void
+    updateObserver()
+    {
+        Lock sync(*this);
+        _thread->updateObserver();
+    }
+
+private:
+
+    const size_t _index;
+#ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
+    struct Cell
+    {
+        atomic<size_t> sequence;
+        Dispatch dispatch;
+    };
+
+    vector<Cell> _cells;
+    const size_t _mask;
+    char _pad1[64]; // Keep producer and consumer positions on different cache lines
+    atomic<size_t> _enqueuePos;
+    char _pad2[64];
+    atomic<size_t> _dequeuePos;
+    char _pad3[64];
+#else
+    mutable IceUtil::Mutex _queueMutex;
+    deque<Dispatch> _queue;
+    const size_t _capacity;
+#endif
+    IceUtilInternal::Atomic _sleeping;
+    bool _destroyed;
+    bool _started;
+    EventHandlerThreadPtr _thread;
+};
+
 IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout) :
     _instance(instance),
 #ifdef ICE_SWIFT
@@ -293,7 +630,8 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _inUseIO(0),
     _nextHandler(_handlers.end()),
 #endif
-    _promote(true)
+    _promote(true),
+    _nextWorker(0)
 {
     PropertiesPtr properties = _instance->initializationData().properties;
 #ifndef ICE_OS_UWP
@@ -379,6 +717,8 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
 
 #ifdef ICE_USE_IOCP
     _selector.setup(_sizeIO);
+#elif defined(ICE_USE_IO_URING)
+    _selector.setup(properties->getPropertyWithDefault(_prefix + ".Backend", "epoll"));
 #endif
 
 #if defined(__APPLE__)
@@ -407,6 +747,93 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
         const_cast<int&>(_priority) = properties->getPropertyAsInt("Ice.ThreadPriority");
     }
 
+    //
+    // The threads can be bound to a set of CPUs, either given explicitly
+    // with Affinity or the CPUs of the NUMA node given with NumaNode. The
+    // memory allocated by the bound threads, including the buffers of the
+    // connections they read and write, is then allocated from the memory
+    // local to these CPUs with the default first touch policy.
+    //
+    string affinity = properties->getProperty(_prefix + ".Affinity");
+    string numaNode = properties->getProperty(_prefix + ".NumaNode");
+    if(!affinity.empty() && !numaNode.empty())
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".NumaNode is ignored when " << _prefix << ".Affinity is set";
+        numaNode.clear();
+    }
+#if defined(__linux__) || (defined(_WIN32) && !defined(ICE_OS_UWP))
+    vector<int> cpus;
+    if(!affinity.empty() && !parseCpuList(affinity, cpus))
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "invalid " << _prefix << ".Affinity value `" << affinity << "'; the threads are not bound";
+        cpus.clear();
+    }
+    else if(!numaNode.empty())
+    {
+#   if defined(__linux__)
+        int node = properties->getPropertyAsInt(_prefix + ".NumaNode");
+        ostringstream os;
+        os << "/sys/devices/system/node/node" << node << "/cpulist";
+        ifstream is(os.str().c_str());
+        string cpulist;
+        if(node < 0 || !getline(is, cpulist) || !parseCpuList(cpulist, cpus))
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "invalid " << _prefix << ".NumaNode value `" << numaNode << "'; the threads are not bound";
+            cpus.clear();
+        }
+        affinity = cpulist;
+#   else
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".NumaNode is not supported on this platform";
+#   endif
+    }
+#   if defined(_WIN32)
+    if(!cpus.empty() && *max_element(cpus.begin(), cpus.end()) >= static_cast<int>(sizeof(DWORD_PTR) * 8))
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "invalid " << _prefix << ".Affinity value `" << affinity << "'; the threads can only be bound to "
+            << "the first " << sizeof(DWORD_PTR) * 8 << " CPUs";
+        cpus.clear();
+    }
+#   endif
+    const_cast<vector<int>&>(_affinity) = cpus;
+#else
+    if(!affinity.empty() || !numaNode.empty())
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << (affinity.empty() ? ".NumaNode" : ".Affinity") << " is not supported on this platform";
+    }
+#endif
+
+    //
+    // With WorkStealing > 0, the IO threads hand the dispatch of incoming
+    // messages to dedicated dispatch workers. This isn't supported with
+    // IOCP or if a dispatcher is configured.
+    //
+    int workers = 0;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP) && !defined(ICE_SWIFT)
+    workers = properties->getPropertyAsInt(_prefix + ".WorkStealing");
+    if(workers == -1)
+    {
+        workers = nProcessors;
+    }
+    if(workers < 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".WorkStealing < 0; WorkStealing adjusted to 0";
+        workers = 0;
+    }
+    else if(workers > 0 && _dispatcher)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".WorkStealing is ignored when a dispatcher is configured";
+        workers = 0;
+    }
+#endif
+
     _workQueue = ICE_MAKE_SHARED(ThreadPoolWorkQueue, *this);
     _selector.initialize(_workQueue.get());
 
@@ -415,11 +842,34 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
         out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = "
             << _sizeWarn;
+        if(workers > 0)
+        {
+            out << ", WorkStealing = " << workers;
+        }
+        if(!_affinity.empty())
+        {
+            out << ", Affinity = " << affinity;
+        }
     }
 
     __setNoDelete(true);
     try
     {
+        //
+        // Create all the workers before starting them, the workers steal
+        // from each other's queues.
+        //
+        for(int i = 0; i < workers; ++i)
+        {
+            ostringstream os;
+            os << _prefix << "-worker-" << i;
+            _workers.push_back(new DispatchWorker(this, os.str(), static_cast<size_t>(i), dispatchWorkerCapacity));
+        }
+        for(vector<DispatchWorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+        {
+            (*p)->start(_stackSize, _hasPriority, _priority);
+        }
+
         for(int i = 0 ; i < _size ; ++i)
         {
             EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId());
@@ -482,6 +932,10 @@ IceInternal::ThreadPool::updateObservers()
     {
         (*p)->updateObserver();
     }
+    for(vector<DispatchWorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->updateObserver();
+    }
 }
 
 void
@@ -626,7 +1080,163 @@ IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
     {
         throw CommunicatorDestroyedException(__FILE__, __LINE__);
     }
-    _workQueue->queue(workItem);
+    if(_workers.empty() || !queueDispatch(workItem, EventHandlerPtr(), SocketOperationNone))
+    {
+        _workQueue->queue(workItem);
+    }
+}
+
+void
+IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workItem, ThreadPoolCurrent& current)
+{
+    if(_workers.empty())
+    {
+        dispatchFromThisThread(workItem);
+        return;
+    }
+
+    //
+    // If serialization is enabled, the handler remains disabled until
+    // the dispatch worker is done with the message. It's disabled by
+    // ioCompleted() unless the thread pool has a single thread.
+    //
+    EventHandlerPtr handler;
+    if(_serialize && current._handler.get() != _workQueue.get())
+    {
+        handler = current._handler;
+        if(_sizeMax == 1)
+        {
+            Lock sync(*this);
+            if(!_destroyed)
+            {
+                _selector.disable(handler.get(), current.operation);
+            }
+        }
+    }
+
+    if(queueDispatch(workItem, handler, current.operation))
+    {
+        if(handler)
+        {
+            current._handedOff = true;
+        }
+    }
+    else
+    {
+        runDispatch(workItem, handler, current.operation); // The queues are full, dispatch from this thread.
+    }
+}
+
+bool
+IceInternal::ThreadPool::queueDispatch(const DispatchWorkItemPtr& workItem, const EventHandlerPtr& handler,
+                                       SocketOperation operation)
+{
+    const size_t sz = _workers.size();
+    const size_t start = static_cast<unsigned int>(_nextWorker++) % sz;
+    for(size_t i = 0; i < sz; ++i)
+    {
+        DispatchWorker* worker = _workers[(start + i) % sz].get();
+        if(worker->push(DispatchWorker::Dispatch(workItem, handler, operation)))
+        {
+            //
+            // If the worker is busy, wake up an idle worker to steal the
+            // dispatch.
+            //
+            if(!worker->wakeUp(true))
+            {
+                for(size_t j = 1; j < sz; ++j)
+                {
+                    if(_workers[(start + i + j) % sz]->wakeUp(false))
+                    {
+                        break;
+                    }
+                }
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+IceInternal::ThreadPool::runDispatch(const DispatchWorkItemPtr& workItem, const EventHandlerPtr& handler,
+                                     SocketOperation operation)
+{
+    try
+    {
+        workItem->run();
+    }
+    catch(const exception& ex)
+    {
+        Error out(_instance->initializationData().logger);
+        out << "exception in `" << _prefix << "':\n" << ex;
+    }
+    catch(...)
+    {
+        Error out(_instance->initializationData().logger);
+        out << "unknown exception in `" << _prefix << "'";
+    }
+
+    if(handler)
+    {
+        Lock sync(*this);
+        _selector.enable(handler.get(), operation);
+    }
+}
+
+void
+IceInternal::ThreadPool::runDispatchWorker(const EventHandlerThreadPtr& thread)
+{
+    DispatchWorker* worker = thread->_worker;
+    const size_t sz = _workers.size();
+    const size_t index = worker->index();
+    DispatchWorker::Dispatch dispatch;
+    while(true)
+    {
+        if(!worker->pop(dispatch))
+        {
+            //
+            // Steal from the other workers, starting with the next one.
+            //
+            bool stolen = false;
+            for(size_t i = 1; i < sz && !stolen; ++i)
+            {
+                DispatchWorker* victim = _workers[(index + i) % sz].get();
+                stolen = victim->pop(dispatch);
+                if(stolen && _instance->traceLevels()->threadPool >= 2)
+                {
+                    Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+                    out << thread->name() << " stole a dispatch from " << victim->thread()->name()
+                        << ": queue depth = " << victim->depth();
+                }
+            }
+
+            if(!stolen)
+            {
+                if(!worker->waitForDispatches(*this))
+                {
+                    return;
+                }
+                continue;
+            }
+        }
+
+        runDispatch(dispatch.workItem, dispatch.handler, dispatch.operation);
+        dispatch = DispatchWorker::Dispatch();
+    }
+}
+
+bool
+IceInternal::ThreadPool::hasQueuedDispatches() const
+{
+    for(vector<DispatchWorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        if((*p)->depth() > 0)
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 void
@@ -644,6 +1254,19 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->getThreadControl().join();
     }
+
+    //
+    // The dispatch workers are destroyed once the IO threads are joined,
+    // they run the remaining queued dispatches before terminating.
+    //
+    for(vector<DispatchWorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->destroy();
+    }
+    for(vector<DispatchWorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->join();
+    }
     _selector.destroy();
 }
 
@@ -666,6 +1289,12 @@ IceInternal::ThreadPool::getDispatchQueue() const ICE_NOEXCEPT
 void
 IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
 {
+    if(thread->_worker)
+    {
+        runDispatchWorker(thread);
+        return;
+    }
+
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     ThreadPoolCurrent current(_instance, this, thread);
     bool select = false;
@@ -743,8 +1372,10 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                     //
                     // If the handler called ioCompleted(), we re-enable the handler in
                     // case it was disabled and we decrease the number of thread in use.
+                    // If the dispatch was handed to a dispatch worker, the worker
+                    // re-enables the handler once the dispatch is completed.
                     //
-                    if(_serialize && current._handler.get() != _workQueue.get())
+                    if(_serialize && current._handler.get() != _workQueue.get() && !current._handedOff)
                     {
                         _selector.enable(current._handler.get(), current.operation);
                     }
@@ -769,6 +1400,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             if(_nextHandler != _handlers.end())
             {
                 current._ioCompleted = false;
+                current._handedOff = false;
                 current._handler = ICE_GET_SHARED_FROM_THIS(_nextHandler->first);
                 current.operation = _nextHandler->second;
                 ++_nextHandler;
@@ -1201,9 +1833,49 @@ IceInternal::ThreadPool::nextThreadId()
     return os.str();
 }
 
-IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPoolPtr& pool, const string& name) :
+void
+IceInternal::ThreadPool::setThreadAffinity(const string& name) const
+{
+    //
+    // Binds the calling thread to the CPUs of _affinity.
+    //
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(vector<int>::const_iterator p = _affinity.begin(); p != _affinity.end(); ++p)
+    {
+        if(*p < CPU_SETSIZE)
+        {
+            CPU_SET(*p, &set);
+        }
+    }
+    int rs = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+    if(rs != 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "couldn't set the CPU affinity of thread `" << name << "':\n" << IceUtilInternal::errorToString(rs);
+    }
+#elif defined(_WIN32) && !defined(ICE_OS_UWP)
+    DWORD_PTR mask = 0;
+    for(vector<int>::const_iterator p = _affinity.begin(); p != _affinity.end(); ++p)
+    {
+        mask |= static_cast<DWORD_PTR>(1) << *p;
+    }
+    if(SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "couldn't set the CPU affinity of thread `" << name << "':\n" << IceUtilInternal::lastErrorToString();
+    }
+#else
+    (void)name;
+#endif
+}
+
+IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPoolPtr& pool, const string& name,
+                                                                DispatchWorker* worker) :
     IceUtil::Thread(name),
     _pool(pool),
+    _worker(worker),
     _state(ICE_ENUM(ThreadState, ThreadStateIdle))
 {
     updateObserver();
@@ -1212,7 +1884,7 @@ IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPool
 void
 IceInternal::ThreadPool::EventHandlerThread::updateObserver()
 {
-    // Must be called with the thread pool mutex locked
+    // Must be called with the thread pool mutex locked (or the worker mutex for dispatch workers)
     const CommunicatorObserverPtr& obsv = _pool->_instance->initializationData().observer;
     if(obsv)
     {
@@ -1223,7 +1895,7 @@ IceInternal::ThreadPool::EventHandlerThread::updateObserver()
 void
 IceInternal::ThreadPool::EventHandlerThread::setState(Ice::Instrumentation::ThreadState s)
 {
-    // Must be called with the thread pool mutex locked
+    // Must be called with the thread pool mutex locked (or the worker mutex for dispatch workers)
     if(_observer)
     {
         if(_state != s)
@@ -1237,6 +1909,11 @@ IceInternal::ThreadPool::EventHandlerThread::setState(Ice::Instrumentation::Thre
 void
 IceInternal::ThreadPool::EventHandlerThread::run()
 {
+    if(!_pool->_affinity.empty())
+    {
+        _pool->setThreadAffinity(name());
+    }
+
 #ifdef ICE_CPP11_MAPPING
     if(_pool->_instance->initializationData().threadStart)
 #else
@@ -1316,7 +1993,8 @@ ThreadPoolCurrent::ThreadPoolCurrent(const InstancePtr& instance,
     stream(instance.get(), Ice::currentProtocolEncoding),
     _threadPool(threadPool.get()),
     _thread(thread),
-    _ioCompleted(false)
+    _ioCompleted(false),
+    _handedOff(false)
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     , _leader(false)
 #endif
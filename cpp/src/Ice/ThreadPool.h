@@ -9,6 +9,7 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Thread.h>
+#include <IceUtil/Atomic.h>
 
 #include <Ice/Config.h>
 #include <Ice/Dispatcher.h>
@@ -63,11 +64,14 @@ typedef IceUtil::Handle<DispatchWorkItem> DispatchWorkItemPtr;
 
 class ThreadPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
 {
+    class DispatchWorker;
+    typedef IceUtil::Handle<DispatchWorker> DispatchWorkerPtr;
+
     class EventHandlerThread : public IceUtil::Thread
     {
     public:
 
-        EventHandlerThread(const ThreadPoolPtr&, const std::string&);
+        EventHandlerThread(const ThreadPoolPtr&, const std::string&, DispatchWorker* = 0);
         virtual void run();
 
         void updateObserver();
@@ -76,8 +80,11 @@ class ThreadPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mut
     private:
 
         ThreadPoolPtr _pool;
+        DispatchWorker* _worker; // Set if this thread runs a work-stealing dispatch worker.
         ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
         Ice::Instrumentation::ThreadState _state;
+
+        friend class ThreadPool;
     };
     typedef IceUtil::Handle<EventHandlerThread> EventHandlerThreadPtr;
 
@@ -106,6 +113,15 @@ public:
     void dispatchFromThisThread(const DispatchWorkItemPtr&);
     void dispatch(const DispatchWorkItemPtr&);
 
+    //
+    // Returns true if dispatches are handed to the work-stealing
+    // dispatch workers instead of being run by the IO threads.
+    //
+    bool hasDispatchWorkers() const
+    {
+        return !_workers.empty();
+    }
+
     void joinWithAllThreads();
 
     std::string prefix() const;
@@ -120,6 +136,12 @@ private:
 
     bool ioCompleted(ThreadPoolCurrent&);
 
+    void dispatchFromThisThread(const DispatchWorkItemPtr&, ThreadPoolCurrent&);
+    bool queueDispatch(const DispatchWorkItemPtr&, const EventHandlerPtr&, SocketOperation);
+    void runDispatch(const DispatchWorkItemPtr&, const EventHandlerPtr&, SocketOperation);
+    void runDispatchWorker(const EventHandlerThreadPtr&);
+    bool hasQueuedDispatches() const;
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     bool startMessage(ThreadPoolCurrent&);
     void finishMessage(ThreadPoolCurrent&);
@@ -129,6 +151,7 @@ private:
 #endif
 
     std::string nextThreadId();
+    void setThreadAffinity(const std::string&) const;
 
     const InstancePtr _instance;
 #ifdef ICE_SWIFT
@@ -147,6 +170,7 @@ private:
     int _nextThreadId;
 
     friend class EventHandlerThread;
+    friend class DispatchWorker;
     friend class ThreadPoolCurrent;
     friend class ThreadPoolWorkQueue;
 
@@ -160,6 +184,7 @@ private:
     const int _serverIdleTime;
     const int _threadIdleTime;
     const size_t _stackSize;
+    const std::vector<int> _affinity; // The CPUs the threads are bound to, empty if they're not bound.
 
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
     int _inUse; // Number of threads that are currently in use.
@@ -170,6 +195,9 @@ private:
 #endif
 
     bool _promote;
+
+    std::vector<DispatchWorkerPtr> _workers; // Work-stealing dispatch workers, immutable after construction.
+    IceUtilInternal::Atomic _nextWorker;
 };
 
 class ThreadPoolCurrent
@@ -205,7 +233,7 @@ public:
 
     void dispatchFromThisThread(const DispatchWorkItemPtr& workItem)
     {
-        _threadPool->dispatchFromThisThread(workItem);
+        _threadPool->dispatchFromThisThread(workItem, *this);
     }
 
 private:
@@ -214,6 +242,7 @@ private:
     ThreadPool::EventHandlerThreadPtr _thread;
     EventHandlerPtr _handler;
     bool _ioCompleted;
+    bool _handedOff; // Set if the dispatch was handed to a dispatch worker which re-enables the handler.
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     bool _leader;
 #else
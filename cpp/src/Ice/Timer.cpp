@@ -33,6 +33,28 @@ Timer::Timer(int priority) :
     __setNoDelete(false);
 }
 
+Timer::Timer(bool) :
+    Thread("IceUtil timer thread"),
+    _destroyed(false)
+{
+}
+
+void
+Timer::startThread()
+{
+    __setNoDelete(true);
+    start();
+    __setNoDelete(false);
+}
+
+void
+Timer::startThread(int priority)
+{
+    __setNoDelete(true);
+    start(0, priority);
+    __setNoDelete(false);
+}
+
 void
 Timer::destroy()
 {
@@ -0,0 +1,611 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/TimerWheel.h>
+#include <Ice/ConsoleUtil.h>
+#include <IceUtil/Exception.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace IceUtil;
+using namespace IceInternal;
+using namespace IceUtilInternal;
+
+namespace
+{
+
+const size_t rootSize = static_cast<size_t>(1) << 8;
+const size_t levelSize = static_cast<size_t>(1) << 6;
+
+struct TaskCompare
+{
+    bool operator()(const TimerWheel::Task& lhs, const TimerWheel::Task& rhs) const
+    {
+        return lhs.scheduledTime < rhs.scheduledTime;
+    }
+};
+
+}
+
+const Int64 IceUtilInternal::TimerWheel::never = IceUtil::Int64(0x7FFFFFFF) << 32 | 0xFFFFFFFF;
+
+IceUtilInternal::TimerWheel::Shard::Shard() :
+    destroyed(false),
+    current(0),
+    next(never),
+    linked(0)
+{
+    fill(root, root + rootSize, static_cast<Entry*>(0));
+    for(size_t i = 0; i < levelCount; ++i)
+    {
+        fill(levels[i], levels[i] + levelSize, static_cast<Entry*>(0));
+    }
+}
+
+IceUtilInternal::TimerWheel::TimerWheel(const Time& tick) :
+    _start(Time::now(Time::Monotonic)),
+    _tick(tick.toMicroSeconds())
+{
+    if(_tick <= 0)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "invalid tick");
+    }
+}
+
+IceUtilInternal::TimerWheel::~TimerWheel()
+{
+    destroy();
+}
+
+void
+IceUtilInternal::TimerWheel::destroy()
+{
+    for(size_t i = 0; i < shardCount; ++i)
+    {
+        Shard& s = _shards[i];
+        Mutex::Lock sync(s.mutex);
+        s.destroyed = true;
+        for(EntryMap::const_iterator p = s.entries.begin(); p != s.entries.end(); ++p)
+        {
+            delete p->second;
+        }
+        s.entries.clear();
+        fill(s.root, s.root + rootSize, static_cast<Entry*>(0));
+        for(size_t j = 0; j < levelCount; ++j)
+        {
+            fill(s.levels[j], s.levels[j] + levelSize, static_cast<Entry*>(0));
+        }
+        s.linked = 0;
+        s.next = never;
+    }
+}
+
+bool
+IceUtilInternal::TimerWheel::schedule(const TimerTaskPtr& task, const Time& delay, bool repeated)
+{
+    Shard& s = shard(task.get());
+    Mutex::Lock sync(s.mutex);
+    if(s.destroyed)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
+    }
+
+    Time now = Time::now(Time::Monotonic);
+    Time time = now + delay;
+    if(delay > Time() && time < now)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
+    }
+
+    if(s.entries.find(task.get()) != s.entries.end())
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
+    }
+
+    Entry* e = new Entry;
+    e->task.task = task;
+    e->task.scheduledTime = time;
+    e->task.delay = repeated ? delay : Time();
+    s.entries.insert(make_pair(task.get(), e));
+    return link(s, e, now);
+}
+
+bool
+IceUtilInternal::TimerWheel::cancel(const TimerTaskPtr& task)
+{
+    Shard& s = shard(task.get());
+    Entry* e;
+    {
+        Mutex::Lock sync(s.mutex);
+        EntryMap::iterator p = s.entries.find(task.get());
+        if(p == s.entries.end())
+        {
+            return false;
+        }
+
+        e = p->second;
+        s.entries.erase(p);
+        if(e->slot)
+        {
+            unlink(s, e);
+        }
+    }
+
+    //
+    // Release the task outside the synchronization, it might call user code.
+    //
+    delete e;
+    return true;
+}
+
+void
+IceUtilInternal::TimerWheel::reschedule(const TimerTaskPtr& task, const Time& delay)
+{
+    Shard& s = shard(task.get());
+    Mutex::Lock sync(s.mutex);
+    EntryMap::iterator p = s.entries.find(task.get());
+    if(s.destroyed || p == s.entries.end() || p->second->slot)
+    {
+        return; // Canceled or destroyed.
+    }
+
+    Time now = Time::now(Time::Monotonic);
+    p->second->task.scheduledTime = now + delay;
+    link(s, p->second, now);
+}
+
+Time
+IceUtilInternal::TimerWheel::expired(vector<Task>& tasks)
+{
+    //
+    // Collect the expired tasks and compute the next tick with tasks of
+    // each shard. A thread scheduling a task that expires before the next
+    // tick of its shard wakes up the timer thread.
+    //
+    Int64 target = (Time::now(Time::Monotonic) - _start).toMicroSeconds() / _tick;
+    Int64 next = never;
+    size_t size = tasks.size();
+    for(size_t i = 0; i < shardCount; ++i)
+    {
+        Shard& s = _shards[i];
+        Mutex::Lock sync(s.mutex);
+        advance(s, target, tasks);
+        s.next = nextTick(s);
+        next = min(next, s.next);
+    }
+
+    stable_sort(tasks.begin() + static_cast<ptrdiff_t>(size), tasks.end(), TaskCompare());
+    return next == never ? Time() : _start + Time::microSeconds(next * _tick);
+}
+
+IceUtilInternal::TimerWheel::Shard&
+IceUtilInternal::TimerWheel::shard(const TimerTask* task)
+{
+    size_t h = reinterpret_cast<size_t>(task);
+    h ^= h >> 4;
+    h ^= h >> 9;
+    return _shards[h & (shardCount - 1)];
+}
+
+bool
+IceUtilInternal::TimerWheel::link(Shard& s, Entry* e, const Time& now)
+{
+    //
+    // The timer thread doesn't advance the ticks of a shard without tasks,
+    // catch up with the current tick before computing the slot of the task.
+    //
+    if(s.linked == 0)
+    {
+        s.current = max(s.current, (now - _start).toMicroSeconds() / _tick);
+    }
+
+    e->expires = ((e->task.scheduledTime - _start).toMicroSeconds() + _tick - 1) / _tick;
+    insert(s, e);
+    ++s.linked;
+
+    //
+    // Wake up the timer thread if the task expires before the next tick it
+    // will check for this shard.
+    //
+    Int64 tick = max(e->expires, s.current);
+    if(tick < s.next)
+    {
+        s.next = tick;
+        return true;
+    }
+    return false;
+}
+
+void
+IceUtilInternal::TimerWheel::unlink(Shard& s, Entry* e)
+{
+    remove(e);
+    --s.linked;
+}
+
+void
+IceUtilInternal::TimerWheel::advance(Shard& s, Int64 target, vector<Task>& tasks)
+{
+    if(s.linked == 0)
+    {
+        s.current = max(s.current, target + 1);
+        return;
+    }
+
+    for(; s.current <= target && s.linked > 0; ++s.current)
+    {
+        size_t index = static_cast<size_t>(s.current) & (rootSize - 1);
+        if(index == 0)
+        {
+            //
+            // Move the tasks of the next slot of each level to the lower
+            // levels, up to the first level that doesn't wrap around.
+            //
+            for(size_t i = 0; i < levelCount; ++i)
+            {
+                size_t slot = static_cast<size_t>(s.current >> (rootBits + i * levelBits)) & (levelSize - 1);
+                Entry* e = s.levels[i][slot];
+                s.levels[i][slot] = 0;
+                while(e)
+                {
+                    Entry* next = e->next;
+                    insert(s, e);
+                    e = next;
+                }
+                if(slot != 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        Entry* e = s.root[index];
+        s.root[index] = 0;
+        while(e)
+        {
+            Entry* next = e->next;
+            e->slot = 0;
+            --s.linked;
+            tasks.push_back(e->task);
+            if(e->task.delay == Time())
+            {
+                s.entries.erase(e->task.task.get());
+                delete e;
+            }
+            e = next;
+        }
+    }
+
+    if(s.linked == 0)
+    {
+        s.current = max(s.current, target + 1);
+    }
+}
+
+Int64
+IceUtilInternal::TimerWheel::nextTick(const Shard& s)
+{
+    if(s.linked == 0)
+    {
+        return never;
+    }
+
+    //
+    // The tasks of a slot of the other levels are moved to the lower levels
+    // when the current tick reaches the first multiple of the slot span that
+    // maps to this slot, they don't expire before.
+    //
+    Int64 next = never;
+    for(size_t i = 0; i < levelCount; ++i)
+    {
+        const int shift = rootBits + static_cast<int>(i) * levelBits;
+        const Int64 first = (s.current + (static_cast<Int64>(1) << shift) - 1) >> shift;
+        for(size_t j = 0; j < levelSize; ++j)
+        {
+            if(s.levels[i][j])
+            {
+                Int64 slot = first + ((static_cast<Int64>(j) - first) & static_cast<Int64>(levelSize - 1));
+                next = min(next, slot << shift);
+            }
+        }
+    }
+
+    //
+    // Each slot of the first level holds the tasks of a single tick within
+    // the next rootSize ticks.
+    //
+    for(Int64 tick = s.current; tick < s.current + static_cast<Int64>(rootSize) && tick < next; ++tick)
+    {
+        if(s.root[static_cast<size_t>(tick) & (rootSize - 1)])
+        {
+            return tick;
+        }
+    }
+    return next;
+}
+
+void
+IceUtilInternal::TimerWheel::insert(Shard& s, Entry* e)
+{
+    Int64 diff = e->expires - s.current;
+    Entry** slot;
+    if(diff < static_cast<Int64>(rootSize))
+    {
+        //
+        // Tasks that already expired are executed on the next tick.
+        //
+        slot = &s.root[static_cast<size_t>(diff < 0 ? s.current : e->expires) & (rootSize - 1)];
+    }
+    else
+    {
+        //
+        // Tasks beyond the last level go to its furthest slot, they are
+        // moved again when the timer thread reaches this slot.
+        //
+        size_t level = levelCount - 1;
+        Int64 expires = min(e->expires, s.current + (static_cast<Int64>(1) << (rootBits + levelCount * levelBits)) - 1);
+        for(size_t i = 0; i < levelCount; ++i)
+        {
+            if(diff < static_cast<Int64>(1) << (rootBits + (i + 1) * levelBits))
+            {
+                level = i;
+                break;
+            }
+        }
+        slot = &s.levels[level][static_cast<size_t>(expires >> (rootBits + level * levelBits)) & (levelSize - 1)];
+    }
+
+    e->slot = slot;
+    e->prev = 0;
+    e->next = *slot;
+    if(e->next)
+    {
+        e->next->prev = e;
+    }
+    *slot = e;
+}
+
+void
+IceUtilInternal::TimerWheel::remove(Entry* e)
+{
+    if(e->prev)
+    {
+        e->prev->next = e->next;
+    }
+    else
+    {
+        *e->slot = e->next;
+    }
+
+    if(e->next)
+    {
+        e->next->prev = e->prev;
+    }
+    e->slot = 0;
+}
+
+
+IceUtilInternal::WheelTimer::WheelTimer(const Time& tick) :
+    IceUtil::Timer(false),
+    _wheel(tick > Time() ? new TimerWheel(tick) : 0),
+    _notified(false)
+{
+    startThread();
+}
+
+IceUtilInternal::WheelTimer::WheelTimer(const Time& tick, int priority) :
+    IceUtil::Timer(false),
+    _wheel(tick > Time() ? new TimerWheel(tick) : 0),
+    _notified(false)
+{
+    startThread(priority);
+}
+
+IceUtilInternal::WheelTimer::~WheelTimer()
+{
+    delete _wheel;
+}
+
+void
+IceUtilInternal::WheelTimer::destroy()
+{
+    if(_wheel)
+    {
+        _wheel->destroy();
+    }
+    IceUtil::Timer::destroy();
+}
+
+void
+IceUtilInternal::WheelTimer::schedule(const TimerTaskPtr& task, const Time& delay)
+{
+    if(!_wheel)
+    {
+        IceUtil::Timer::schedule(task, delay);
+    }
+    else if(_wheel->schedule(task, delay, false))
+    {
+        notify();
+    }
+}
+
+void
+IceUtilInternal::WheelTimer::scheduleRepeated(const TimerTaskPtr& task, const Time& delay)
+{
+    if(!_wheel)
+    {
+        IceUtil::Timer::scheduleRepeated(task, delay);
+    }
+    else if(_wheel->schedule(task, delay, true))
+    {
+        notify();
+    }
+}
+
+bool
+IceUtilInternal::WheelTimer::cancel(const TimerTaskPtr& task)
+{
+    return _wheel ? _wheel->cancel(task) : IceUtil::Timer::cancel(task);
+}
+
+void
+IceUtilInternal::WheelTimer::run()
+{
+    if(!_wheel)
+    {
+        IceUtil::Timer::run();
+        return;
+    }
+
+    vector<TimerWheel::Task> tasks;
+    vector<Token> tokens;
+    while(true)
+    {
+        {
+            Monitor<Mutex>::Lock sync(_monitor);
+            if(_destroyed)
+            {
+                break;
+            }
+            _notified = false;
+        }
+
+        Time next = _wheel->expired(tasks);
+
+        {
+            Monitor<Mutex>::Lock sync(_monitor);
+            if(_destroyed)
+            {
+                break;
+            }
+
+            //
+            // Collect the expired tasks scheduled with the IceUtil::Timer
+            // methods, see IceUtil::Timer::run().
+            //
+            Time now = Time::now(Time::Monotonic);
+            while(!_tokens.empty() && _tokens.begin()->scheduledTime <= now)
+            {
+                tokens.push_back(*_tokens.begin());
+                _tokens.erase(_tokens.begin());
+                if(tokens.back().delay == Time())
+                {
+                    _tasks.erase(tokens.back().task);
+                }
+            }
+
+            if(tasks.empty() && tokens.empty())
+            {
+                if(_notified)
+                {
+                    continue;
+                }
+
+                if(!_tokens.empty() && (next == Time() || _tokens.begin()->scheduledTime < next))
+                {
+                    next = _tokens.begin()->scheduledTime;
+                }
+
+                //
+                // IceUtil::Timer::schedule() wakes up the timer thread if the
+                // task expires before _wakeUpTime.
+                //
+                _wakeUpTime = next;
+                if(next == Time())
+                {
+                    _monitor.wait();
+                }
+                else if(next > now)
+                {
+                    _monitor.timedWait(next - now);
+                }
+                continue;
+            }
+        }
+
+        //
+        // Execute the tasks of the wheel and of the IceUtil::Timer ordered by
+        // execution time.
+        //
+        vector<TimerWheel::Task>::const_iterator p = tasks.begin();
+        vector<Token>::iterator q = tokens.begin();
+        while(p != tasks.end() || q != tokens.end())
+        {
+            {
+                Monitor<Mutex>::Lock sync(_monitor);
+                if(_destroyed)
+                {
+                    break;
+                }
+            }
+
+            if(q == tokens.end() || (p != tasks.end() && p->scheduledTime <= q->scheduledTime))
+            {
+                runTask(p->task);
+                if(p->delay != Time())
+                {
+                    _wheel->reschedule(p->task, p->delay);
+                }
+                ++p;
+            }
+            else
+            {
+                runTask(q->task);
+                if(q->delay != Time())
+                {
+                    Monitor<Mutex>::Lock sync(_monitor);
+                    map<TimerTaskPtr, Time, TimerTaskCompare>::iterator r = _tasks.find(q->task);
+                    if(!_destroyed && r != _tasks.end())
+                    {
+                        q->scheduledTime = Time::now(Time::Monotonic) + q->delay;
+                        r->second = q->scheduledTime;
+                        _tokens.insert(*q);
+                    }
+                }
+                ++q;
+            }
+        }
+
+        //
+        // Clear the task references outside the synchronization, clearing a
+        // reference might call user code, see IceUtil::Timer::run().
+        //
+        tasks.clear();
+        tokens.clear();
+    }
+}
+
+void
+IceUtilInternal::WheelTimer::notify()
+{
+    Monitor<Mutex>::Lock sync(_monitor);
+    _notified = true;
+    _monitor.notify();
+}
+
+void
+IceUtilInternal::WheelTimer::runTask(const TimerTaskPtr& task)
+{
+    try
+    {
+        runTimerTask(task);
+    }
+    catch(const IceUtil::Exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what();
+#ifdef __GNUC__
+        consoleErr << "\n" << e.ice_stackTrace();
+#endif
+        consoleErr << endl;
+    }
+    catch(const std::exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what() << endl;
+    }
+    catch(...)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception" << endl;
+    }
+}
@@ -0,0 +1,163 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_TIMER_WHEEL_H
+#define ICE_TIMER_WHEEL_H
+
+#include <IceUtil/Timer.h>
+
+#include <vector>
+
+#ifdef ICE_CPP11_COMPILER
+#   include <unordered_map>
+#endif
+
+namespace IceUtilInternal
+{
+
+//
+// The hierarchical timing wheel of a WheelTimer. The tasks are split into shards by address, each shard with its own
+// mutex and wheel, so that threads scheduling and canceling different tasks
+// don't contend. A wheel has a level of 256 slots of one tick followed by
+// three levels of 64 slots, each slot of a level spanning all the slots of
+// the previous level. Tasks are moved to the lower level when the timer
+// thread reaches their slot, tasks beyond the last level are kept in its
+// furthest slot until they get closer.
+//
+// The wheel doesn't have a thread, the WheelTimer thread sleeps until the
+// first tick with tasks to execute or to move to a lower level, it's woken
+// up by threads scheduling a task that expires before this tick.
+//
+class TimerWheel : private IceUtil::noncopyable
+{
+public:
+
+    struct Task
+    {
+        IceUtil::TimerTaskPtr task;
+        IceUtil::Time scheduledTime;
+        IceUtil::Time delay;
+    };
+
+    TimerWheel(const IceUtil::Time&);
+    ~TimerWheel();
+
+    void destroy();
+
+    //
+    // Schedule a task, the delay between each execution is given for
+    // repeated tasks. Returns true if the timer thread must be woken up
+    // because the task expires before the next tick it waits for.
+    //
+    bool schedule(const IceUtil::TimerTaskPtr&, const IceUtil::Time&, bool);
+    bool cancel(const IceUtil::TimerTaskPtr&);
+
+    //
+    // Schedule again a repeated task that was just executed, unless it was
+    // canceled.
+    //
+    void reschedule(const IceUtil::TimerTaskPtr&, const IceUtil::Time&);
+
+    //
+    // Add the expired tasks ordered by execution time and return the
+    // monotonic time of the next tick with tasks, or a zero time if there
+    // are no tasks.
+    //
+    IceUtil::Time expired(std::vector<Task>&);
+
+    //
+    // The largest tick, used as the next tick of a shard without tasks.
+    //
+    static const IceUtil::Int64 never;
+
+private:
+
+    struct Entry
+    {
+        Entry* prev;
+        Entry* next;
+        Entry** slot;
+        IceUtil::Int64 expires;
+        Task task;
+    };
+
+#ifdef ICE_CPP11_COMPILER
+    typedef std::unordered_map<const IceUtil::TimerTask*, Entry*> EntryMap;
+#else
+    typedef std::map<const IceUtil::TimerTask*, Entry*> EntryMap;
+#endif
+
+    static const size_t shardCount = 16; // Must be a power of two.
+    static const int rootBits = 8;
+    static const int levelBits = 6;
+    static const size_t levelCount = 3;
+
+    struct Shard
+    {
+        Shard();
+
+        IceUtil::Mutex mutex;
+        bool destroyed;
+        IceUtil::Int64 current;
+        IceUtil::Int64 next;
+        size_t linked;
+        EntryMap entries;
+        Entry* root[1 << rootBits];
+        Entry* levels[levelCount][1 << levelBits];
+    };
+
+    Shard& shard(const IceUtil::TimerTask*);
+    bool link(Shard&, Entry*, const IceUtil::Time&);
+    void unlink(Shard&, Entry*);
+    void advance(Shard&, IceUtil::Int64, std::vector<Task>&);
+
+    static IceUtil::Int64 nextTick(const Shard&);
+    static void insert(Shard&, Entry*);
+    static void remove(Entry*);
+
+    const IceUtil::Time _start;
+    const IceUtil::Int64 _tick;
+    Shard _shards[shardCount];
+};
+
+//
+// A timer that keeps its tasks in a timing wheel with the given tick, see
+// Ice.TimerTick. This is the timer of the communicator, the Ice runtime
+// schedules its tasks with the methods below, which hide the IceUtil::Timer
+// methods. The tasks scheduled with the IceUtil::Timer methods, for example
+// by plug-ins through IceInternal::getInstanceTimer(), are kept by the
+// IceUtil::Timer as usual and the timer thread executes the tasks of both.
+// A WheelTimer constructed with a zero tick doesn't have a wheel and behaves
+// like an IceUtil::Timer.
+//
+class WheelTimer : public IceUtil::Timer
+{
+public:
+
+    WheelTimer(const IceUtil::Time&);
+    WheelTimer(const IceUtil::Time&, int);
+    virtual ~WheelTimer();
+
+    void destroy();
+    void schedule(const IceUtil::TimerTaskPtr&, const IceUtil::Time&);
+    void scheduleRepeated(const IceUtil::TimerTaskPtr&, const IceUtil::Time&);
+    bool cancel(const IceUtil::TimerTaskPtr&);
+
+protected:
+
+    virtual void run();
+
+private:
+
+    void notify();
+    void runTask(const IceUtil::TimerTaskPtr&);
+
+    TimerWheel* _wheel;
+    bool _notified;
+};
+typedef IceUtil::Handle<WheelTimer> WheelTimerPtr;
+
+}
+
+#endif
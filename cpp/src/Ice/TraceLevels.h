@@ -38,6 +38,9 @@ public:
 
     const int threadPool;
     const char* threadPoolCat;
+
+    const int bufferPool;
+    const char* bufferPoolCat;
 };
 
 }
@@ -15,6 +15,7 @@
 #include <Ice/InputStream.h>
 #include <Ice/Protocol.h>
 #include <Ice/ReplyStatus.h>
+#include <Ice/Compressor.h>
 #include <set>
 
 using namespace std;
@@ -154,30 +155,61 @@ printHeader(ostream& s, InputStream& stream)
     stream.read(compress);
     s << "\ncompression status = "  << static_cast<int>(compress) << ' ';
 
-    switch(compress)
+    if(type == validateConnectionMsg && compress != 0)
     {
-        case 0:
+        //
+        // The compression status of the validate connection message is
+        // the mask of the compressors supported in addition to bzip2.
+        //
+        s << "(compressors supported:";
+        for(Byte status = compressionStatusLZ4; status <= compressionStatusZstd; ++status)
         {
-            s << "(not compressed; do not compress response, if any)";
-            break;
-        }
-
-        case 1:
-        {
-            s << "(not compressed; compress response, if any)";
-            break;
+            if(compress & compressorMask(status))
+            {
+                s << ' ' << (status == compressionStatusLZ4 ? "lz4" : "zstd");
+            }
         }
-
-        case 2:
-        {
-            s << "(compressed; compress response, if any)";
-            break;
-        }
-
-        default:
+        s << ')';
+    }
+    else
+    {
+        switch(compress)
         {
-            s << "(unknown)";
-            break;
+            case 0:
+            {
+                s << "(not compressed; do not compress response, if any)";
+                break;
+            }
+
+            case 1:
+            {
+                s << "(not compressed; compress response, if any)";
+                break;
+            }
+
+            case 2:
+            {
+                s << "(compressed; compress response, if any)";
+                break;
+            }
+
+            case 3:
+            {
+                s << "(compressed with lz4; compress response, if any)";
+                break;
+            }
+
+            case 4:
+            {
+                s << "(compressed with zstd; compress response, if any)";
+                break;
+            }
+
+            default:
+            {
+                s << "(unknown)";
+                break;
+            }
         }
     }
 
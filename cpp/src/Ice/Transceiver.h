@@ -28,6 +28,7 @@ public:
     virtual void close() = 0;
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&) = 0;
+    virtual SocketOperation writev(const std::vector<Buffer*>&);
     virtual SocketOperation read(Buffer&) = 0;
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&) = 0;
@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Connection.h>
+#include <Ice/IncomingAsync.h>
 #include <Ice/ObjectAdapter.h>
 #include <Ice/Service.h>
 #include <Ice/UUID.h>
@@ -55,15 +56,36 @@ struct QueuedInvocation : public IceUtil::Shared
 {
     //
     // The pointers in paramData refer to the Ice marshaling buffer and won't remain valid after
-    // ice_invoke_async completes, so we have to make a copy of the parameter data.
+    // ice_invoke_async completes, so we either retain the marshaling buffer or, if it can't be
+    // retained, make a copy of the parameter data.
     //
     QueuedInvocation(const AMD_Object_ice_invokePtr& c, const pair<const Byte*, const Byte*>& p, const Current& curr) :
-        cb(c), paramData(p.first, p.second), current(curr)
+        cb(c), paramData(p), current(curr)
     {
+        IceInternal::IncomingAsync* incoming = dynamic_cast<IceInternal::IncomingAsync*>(c.get());
+        if(incoming)
+        {
+            buffer = incoming->retainBuffer();
+        }
+        if(!buffer)
+        {
+            paramCopy.assign(p.first, p.second);
+            if(paramCopy.empty())
+            {
+                paramData.first = paramData.second = 0;
+            }
+            else
+            {
+                paramData.first = &paramCopy[0];
+                paramData.second = paramData.first + paramCopy.size();
+            }
+        }
     }
 
     const AMD_Object_ice_invokePtr cb;
-    const vector<Byte> paramData;
+    pair<const Byte*, const Byte*> paramData;
+    IceInternal::RetainedBufferPtr buffer;
+    vector<Byte> paramCopy;
     const Current current;
 };
 typedef IceUtil::Handle<QueuedInvocation> QueuedInvocationPtr;
@@ -334,8 +356,7 @@ BridgeConnection::outgoingSuccess(const ConnectionPtr& outgoing)
     //
     for(vector<QueuedInvocationPtr>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
     {
-        pair<const Byte*, const Byte*> paramData(&(*p)->paramData[0], &(*p)->paramData[0] + (*p)->paramData.size());
-        send(outgoing, (*p)->cb, paramData, (*p)->current);
+        send(outgoing, (*p)->cb, (*p)->paramData, (*p)->current);
     }
     _queue.clear();
 }
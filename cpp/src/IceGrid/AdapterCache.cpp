@@ -28,6 +28,17 @@ struct ReplicaLoadComp : binary_function<ServerAdapterEntryPtr&, ServerAdapterEn
     }
 };
 
+typedef pair<float, float> ReplicaLatency; // Expected latency, request rate
+
+struct ReplicaLatencyComp
+{
+    bool operator()(const pair<ReplicaLatency, ServerAdapterEntryPtr>& lhs,
+                    const pair<ReplicaLatency, ServerAdapterEntryPtr>& rhs)
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
 struct ReplicaPriorityComp : binary_function<ServerAdapterEntryPtr&, ServerAdapterEntryPtr&, bool>
 {
     bool operator()(const ServerAdapterEntryPtr& lhs, const ServerAdapterEntryPtr& rhs)
@@ -59,8 +70,64 @@ struct TransformToReplica : public unary_function<const pair<string, ServerAdapt
     {
         return value.second;
     }
+
+    ServerAdapterEntryPtr
+    operator()(const pair<ReplicaLatency, ServerAdapterEntryPtr>& value)
+    {
+        return value.second;
+    }
 };
 
+//
+// Compute the latency of each replica from the load reported by its
+// server: the expected latency of a new request is the average latency
+// weighted by the number of requests already being dispatched, the
+// request rate breaks the ties. The replicas without a recent load
+// report are given the average latency of the other replicas so that
+// new replicas still get some requests. Returns false if none of the
+// replicas has a recent load report.
+//
+bool
+getReplicaLatencies(const AdapterCache& cache, const vector<ServerAdapterEntryPtr>& replicas,
+                    vector<pair<ReplicaLatency, ServerAdapterEntryPtr> >& rl)
+{
+    ReplicaLatency total(0.0f, 0.0f);
+    int reported = 0;
+    rl.reserve(replicas.size());
+    for(vector<ServerAdapterEntryPtr>::const_iterator p = replicas.begin(); p != replicas.end(); ++p)
+    {
+        AdapterLoad load;
+        ReplicaLatency latency(-1.0f, -1.0f);
+        if(cache.getLoad((*p)->getId(), load))
+        {
+            latency.first = load.latency * static_cast<float>(load.inFlight + 1);
+            latency.second = load.requestRate;
+            total.first += latency.first;
+            total.second += latency.second;
+            ++reported;
+        }
+        rl.push_back(make_pair(latency, *p));
+    }
+
+    if(reported == 0)
+    {
+        return false;
+    }
+
+    if(reported < static_cast<int>(rl.size()))
+    {
+        ReplicaLatency average(total.first / static_cast<float>(reported), total.second / static_cast<float>(reported));
+        for(vector<pair<ReplicaLatency, ServerAdapterEntryPtr> >::iterator p = rl.begin(); p != rl.end(); ++p)
+        {
+            if(p->first.first < 0.0f)
+            {
+                p->first = average;
+            }
+        }
+    }
+    return true;
+}
+
 class ReplicaGroupSyncCallback : public SynchronizationCallback, public IceUtil::Mutex
 {
 public:
@@ -211,7 +278,10 @@ GetAdapterInfoResult::get()
     return _adapters;
 }
 
-AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) : _communicator(communicator)
+AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) :
+    _communicator(communicator),
+    _loadTimeout(IceUtil::Time::seconds(communicator->getProperties()->getPropertyAsIntWithDefault(
+                                            "IceGrid.Registry.AdapterLoadTimeout", 60)))
 {
 }
 
@@ -286,9 +356,56 @@ AdapterCache::get(const string& id) const
     return entry;
 }
 
+void
+AdapterCache::setLoads(const AdapterLoadDict& loads)
+{
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+
+    IceUtil::Mutex::Lock sync(_loadMutex);
+    for(AdapterLoadDict::const_iterator p = loads.begin(); p != loads.end(); ++p)
+    {
+        _loads[p->first] = make_pair(p->second, now);
+    }
+
+    //
+    // Prune the loads which are no longer reported, the adapters of
+    // servers which are no longer active for instance.
+    //
+    map<string, pair<AdapterLoad, IceUtil::Time> >::iterator p = _loads.begin();
+    while(p != _loads.end())
+    {
+        if(now - p->second.second > _loadTimeout)
+        {
+            _loads.erase(p++);
+        }
+        else
+        {
+            ++p;
+        }
+    }
+}
+
+bool
+AdapterCache::getLoad(const string& id, AdapterLoad& load) const
+{
+    IceUtil::Mutex::Lock sync(_loadMutex);
+    map<string, pair<AdapterLoad, IceUtil::Time> >::const_iterator p = _loads.find(id);
+    if(p == _loads.end() || IceUtil::Time::now(IceUtil::Time::Monotonic) - p->second.second > _loadTimeout)
+    {
+        return false;
+    }
+    load = p->second.first;
+    return true;
+}
+
 void
 AdapterCache::removeServerAdapter(const string& id)
 {
+    {
+        IceUtil::Mutex::Lock sync(_loadMutex);
+        _loads.erase(id);
+    }
+
     Lock sync(*this);
 
     ServerAdapterEntryPtr entry = ServerAdapterEntryPtr::dynamicCast(getImpl(id));
@@ -521,6 +638,7 @@ ReplicaGroupEntry::ReplicaGroupEntry(AdapterCache& cache,
                                      const LoadBalancingPolicyPtr& policy,
                                      const string& filter) :
     AdapterEntry(cache, id, application),
+    _twoChoices(false),
     _lastReplica(0),
     _requestInProgress(false)
 {
@@ -639,6 +757,8 @@ ReplicaGroupEntry::update(const string& application, const LoadBalancingPolicyPt
             _loadSample = LoadSample1;
         }
     }
+    LatencyLoadBalancingPolicyPtr llb = LatencyLoadBalancingPolicyPtr::dynamicCast(_loadBalancing);
+    _twoChoices = llb && llb->selection == "two-choices";
 }
 
 void
@@ -647,6 +767,8 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
 {
     vector<ServerAdapterEntryPtr> replicas;
     bool adaptive = false;
+    bool latency = false;
+    bool twoChoices = false;
     LoadSample loadSample = LoadSample1;
     {
         Lock sync(*this);
@@ -683,6 +805,13 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             loadSample = _loadSample;
             adaptive = true;
         }
+        else if(LatencyLoadBalancingPolicyPtr::dynamicCast(_loadBalancing))
+        {
+            replicas = _replicas;
+            IceUtilInternal::shuffle(replicas.begin(), replicas.end());
+            twoChoices = _twoChoices;
+            latency = true;
+        }
         else if(OrderedLoadBalancingPolicyPtr::dynamicCast(_loadBalancing))
         {
             replicas = _replicas;
@@ -714,6 +843,35 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             replicas.clear();
             transform(rl.begin(), rl.end(), back_inserter(replicas), TransformToReplica());
         }
+        else if(latency)
+        {
+            //
+            // Like for the adaptive policy, we sort a snapshot of the
+            // load reported by each replica. If no replica reported its
+            // load, the replicas are returned in random order.
+            //
+            vector<pair<ReplicaLatency, ServerAdapterEntryPtr> > rl;
+            if(getReplicaLatencies(_cache, replicas, rl))
+            {
+                if(twoChoices)
+                {
+                    //
+                    // The replicas are shuffled, the first two replicas
+                    // are the two random choices.
+                    //
+                    if(rl.size() > 1 && ReplicaLatencyComp()(rl[1], rl[0]))
+                    {
+                        swap(replicas[0], replicas[1]);
+                    }
+                }
+                else
+                {
+                    stable_sort(rl.begin(), rl.end(), ReplicaLatencyComp());
+                    replicas.clear();
+                    transform(rl.begin(), rl.end(), back_inserter(replicas), TransformToReplica());
+                }
+            }
+        }
 
         //
         // Retrieve the proxy of each adapter from the server. The adapter
@@ -143,6 +143,7 @@ private:
     LoadBalancingPolicyPtr _loadBalancing;
     int _loadBalancingNReplicas;
     LoadSample _loadSample;
+    bool _twoChoices;
     std::string _filter;
     std::vector<ServerAdapterEntryPtr> _replicas;
     int _lastReplica;
@@ -164,6 +165,9 @@ public:
     void removeServerAdapter(const std::string&);
     void removeReplicaGroup(const std::string&);
 
+    void setLoads(const AdapterLoadDict&);
+    bool getLoad(const std::string&, AdapterLoad&) const;
+
 protected:
 
     virtual AdapterEntryPtr addImpl(const std::string&, const AdapterEntryPtr&);
@@ -172,6 +176,15 @@ protected:
 private:
 
     const Ice::CommunicatorPtr _communicator;
+    const IceUtil::Time _loadTimeout;
+
+    //
+    // The loads reported by the nodes are kept in a separate map with
+    // its own mutex: the updates are frequent and they shouldn't
+    // contend with the cache or the database locks.
+    //
+    mutable IceUtil::Mutex _loadMutex;
+    std::map<std::string, std::pair<AdapterLoad, IceUtil::Time> > _loads;
 };
 
 };
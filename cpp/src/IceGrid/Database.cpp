@@ -8,6 +8,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/Communicator.h>
 #include <Ice/ObjectAdapter.h>
+#include <Ice/UUID.h>
 #include <IceGrid/Database.h>
 #include <IceGrid/TraceLevels.h>
 #include <IceGrid/Util.h>
@@ -42,6 +43,10 @@ const string objectsByTypeDbName = "objectsByType";
 const string internalObjectsDbName = "internal-objects";
 const string internalObjectsByTypeDbName = "internal-objectsByType";
 const string serialsDbName = "serials";
+const string epochsDbName = "epochs";
+const string applicationChangesDbName = "applications-changes";
+const string adapterChangesDbName = "adapters-changes";
+const string objectChangesDbName = "objects-changes";
 
 struct ObjectLoadCI : binary_function<pair<Ice::ObjectPrx, float>&, pair<Ice::ObjectPrx, float>&, bool>
 {
@@ -200,6 +205,8 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _traceLevels(traceLevels),
     _master(info.name == "Master"),
     _readonly(readonly || !_master),
+    _changeLogSize(_communicator->getProperties()->getPropertyAsIntWithDefault("IceGrid.Registry.ChangeLogSize",
+                                                                               10000)),
     _replicaCache(_communicator, topicManager),
     _nodeCache(_communicator, _replicaCache, _readonly && _master ? string("Master (read-only)") : info.name),
     _adapterCache(_communicator),
@@ -207,7 +214,7 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _allocatableObjectCache(_communicator),
     _serverCache(_communicator, _instanceName, _nodeCache, _adapterCache, _objectCache, _allocatableObjectCache),
     _dbLock(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path") + "/icedb.lock"),
-    _env(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path"), 8,
+    _env(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path"), 12,
          IceDB::getMapSize(_communicator->getProperties()->getPropertyAsInt("IceGrid.Registry.LMDB.MapSize"))),
     _pluginFacade(RegistryPluginFacadeIPtr::dynamicCast(getRegistryPluginFacade())),
     _lock(0)
@@ -231,6 +238,11 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _internalObjectsByType = StringIdentityMap(txn, internalObjectsByTypeDbName, context, MDB_CREATE|MDB_DUPSORT);
 
     _serials = StringLongMap(txn, serialsDbName, context, MDB_CREATE);
+    _epochs = StringStringMap(txn, epochsDbName, context, MDB_CREATE);
+
+    _applicationChanges = SerialStringSeqMap(txn, applicationChangesDbName, context, MDB_CREATE);
+    _adapterChanges = SerialStringSeqMap(txn, adapterChangesDbName, context, MDB_CREATE);
+    _objectChanges = SerialStringSeqMap(txn, objectChangesDbName, context, MDB_CREATE);
 
     ServerEntrySeq entries;
 
@@ -277,12 +289,42 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
         _serials.put(txn, objectsDbName, 1);
     }
 
+    //
+    // Start the change logs if they are empty and generate the epochs of
+    // the databases created by this registry. The serials of a database
+    // are only comparable with the serials of a database with the same
+    // epoch.
+    //
+    const string dbNames[] = { applicationsDbName, adaptersDbName, objectsDbName };
+    for(size_t i = 0; i < sizeof(dbNames) / sizeof(string); ++i)
+    {
+        SerialKey key;
+        Ice::StringSeq changes;
+        IceDB::ReadWriteCursor<SerialKey, Ice::StringSeq, IceDB::IceContext, Ice::OutputStream> logCursor(
+            getChangeLog(dbNames[i]), txn);
+        if(!logCursor.get(key, changes, MDB_FIRST))
+        {
+            clearChanges(txn, dbNames[i], getSerial(txn, dbNames[i]));
+        }
+
+        string epoch;
+        if(!_epochs.get(txn, dbNames[i], epoch))
+        {
+            updateEpoch(txn, dbNames[i]);
+        }
+    }
+
     _applicationObserverTopic =
-        new ApplicationObserverTopic(_topicManager, toMap(txn, _applications), getSerial(txn, applicationsDbName));
+        new ApplicationObserverTopic(_topicManager, toMap(txn, _applications), getSerial(txn, applicationsDbName),
+                                     getEpoch(txn, applicationsDbName));
+    const int pageSize =
+        _communicator->getProperties()->getPropertyAsIntWithDefault("IceGrid.Registry.ObserverInitPageSize", 1000);
     _adapterObserverTopic =
-        new AdapterObserverTopic(_topicManager, toMap(txn, _adapters), getSerial(txn, adaptersDbName));
+        new AdapterObserverTopic(_topicManager, toMap(txn, _adapters), getSerial(txn, adaptersDbName),
+                                 getEpoch(txn, adaptersDbName), pageSize);
     _objectObserverTopic =
-        new ObjectObserverTopic(_topicManager, toMap(txn, _objects), getSerial(txn, objectsDbName));
+        new ObjectObserverTopic(_topicManager, toMap(txn, _objects), getSerial(txn, objectsDbName),
+                                getEpoch(txn, objectsDbName), pageSize);
 
     txn.commit();
 
@@ -330,6 +372,76 @@ Database::getObserverTopic(TopicName name) const
     return 0;
 }
 
+int
+Database::subscribeReplicaObserver(TopicName name, const DatabaseObserverPrx& observer, const string& replicaName,
+                                   const StringLongDict& replicaSerials, const StringStringDict& replicaEpochs)
+{
+    string dbName;
+    switch(name)
+    {
+    case ApplicationObserverTopicName:
+        dbName = applicationsDbName;
+        break;
+    case AdapterObserverTopicName:
+        dbName = adaptersDbName;
+        break;
+    case ObjectObserverTopicName:
+        dbName = objectsDbName;
+        break;
+    default:
+        assert(false);
+        break;
+    }
+
+    //
+    // The database lock ensures that no updates are published between
+    // the read of the change log and the subscription of the observer.
+    //
+    // The replica serial is only meaningful if the replica database was
+    // synchronized with this database: the serials of a database created
+    // again or initialized from another replica restart from a different
+    // point in another epoch.
+    //
+    Lock sync(*this);
+    IceUtil::Optional<Ice::StringSeq> changes;
+    StringLongDict::const_iterator p = replicaSerials.find(dbName);
+    const Ice::Long replicaSerial = p != replicaSerials.end() ? p->second : 0;
+    StringStringDict::const_iterator q = replicaEpochs.find(dbName);
+    if(replicaSerial > 0 && q != replicaEpochs.end())
+    {
+        try
+        {
+            IceDB::ReadOnlyTxn txn(_env);
+            Ice::StringSeq keys;
+            if(q->second == getEpoch(txn, dbName) && getChanges(txn, dbName, replicaSerial, keys))
+            {
+                changes = keys;
+            }
+        }
+        catch(const IceDB::LMDBException& ex)
+        {
+            logError(_communicator, ex);
+        }
+    }
+
+    if(_traceLevels->replica > 0)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->replicaCat);
+        out << "replica `" << replicaName << "' " << dbName << " ";
+        if(changes)
+        {
+            out << "incremental synchronization (" << changes->size() << " change(s) since serial `"
+                << replicaSerial << "')";
+        }
+        else
+        {
+            out << "full synchronization";
+        }
+    }
+
+    return getObserverTopic(name)->subscribe(observer, replicaName, changes);
+}
+
 void
 Database::checkSessionLock(AdminSessionI* session)
 {
@@ -370,7 +482,7 @@ Database::unlock(AdminSessionI* session)
 }
 
 void
-Database::syncApplications(const ApplicationInfoSeq& newApplications, Ice::Long dbSerial)
+Database::syncApplications(const ApplicationInfoSeq& newApplications, Ice::Long dbSerial, const string& dbEpoch)
 {
     assert(dbSerial != 0);
     int serial = 0;
@@ -378,6 +490,7 @@ Database::syncApplications(const ApplicationInfoSeq& newApplications, Ice::Long
         Lock sync(*this);
 
         map<string, ApplicationInfo> oldApplications;
+        string epoch;
         try
         {
             IceDB::ReadWriteTxn txn(_env);
@@ -389,6 +502,8 @@ Database::syncApplications(const ApplicationInfoSeq& newApplications, Ice::Long
                 _applications.put(txn, p->descriptor.name, *p);
             }
             dbSerial = updateSerial(txn, applicationsDbName, dbSerial);
+            clearChanges(txn, applicationsDbName, dbSerial);
+            epoch = updateEpoch(txn, applicationsDbName, dbEpoch);
 
             txn.commit();
         }
@@ -441,18 +556,19 @@ Database::syncApplications(const ApplicationInfoSeq& newApplications, Ice::Long
             out << "synchronized applications (serial = `" << dbSerial << "')";
         }
 
-        serial = _applicationObserverTopic->applicationInit(dbSerial, newApplications);
+        serial = _applicationObserverTopic->applicationInit(dbSerial, newApplications, epoch);
     }
     _applicationObserverTopic->waitForSyncedSubscribers(serial);
 }
 
 void
-Database::syncAdapters(const AdapterInfoSeq& adapters, Ice::Long dbSerial)
+Database::syncAdapters(const AdapterInfoSeq& adapters, Ice::Long dbSerial, const string& dbEpoch)
 {
     assert(dbSerial != 0);
     int serial = 0;
     {
         Lock sync(*this);
+        string epoch;
         try
         {
             IceDB::ReadWriteTxn txn(_env);
@@ -464,6 +580,8 @@ Database::syncAdapters(const AdapterInfoSeq& adapters, Ice::Long dbSerial)
                 addAdapter(txn, *r);
             }
             dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
+            clearChanges(txn, adaptersDbName, dbSerial);
+            epoch = updateEpoch(txn, adaptersDbName, dbEpoch);
 
             txn.commit();
         }
@@ -483,18 +601,19 @@ Database::syncAdapters(const AdapterInfoSeq& adapters, Ice::Long dbSerial)
             out << "synchronized adapters (serial = `" << dbSerial << "')";
         }
 
-        serial = _adapterObserverTopic->adapterInit(dbSerial, adapters);
+        serial = _adapterObserverTopic->adapterInit(dbSerial, adapters, epoch);
     }
     _adapterObserverTopic->waitForSyncedSubscribers(serial);
 }
 
 void
-Database::syncObjects(const ObjectInfoSeq& objects, Ice::Long dbSerial)
+Database::syncObjects(const ObjectInfoSeq& objects, Ice::Long dbSerial, const string& dbEpoch)
 {
     assert(dbSerial != 0);
     int serial = 0;
     {
         Lock sync(*this);
+        string epoch;
         try
         {
             IceDB::ReadWriteTxn txn(_env);
@@ -506,6 +625,8 @@ Database::syncObjects(const ObjectInfoSeq& objects, Ice::Long dbSerial)
                 addObject(txn, *q, false);
             }
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
+            clearChanges(txn, objectsDbName, dbSerial);
+            epoch = updateEpoch(txn, objectsDbName, dbEpoch);
 
             txn.commit();
         }
@@ -521,7 +642,213 @@ Database::syncObjects(const ObjectInfoSeq& objects, Ice::Long dbSerial)
             out << "synchronized objects (serial = `" << dbSerial << "')";
         }
 
-        serial = _objectObserverTopic->objectInit(dbSerial, objects);
+        serial = _objectObserverTopic->objectInit(dbSerial, objects, epoch);
+    }
+    _objectObserverTopic->waitForSyncedSubscribers(serial);
+}
+
+void
+Database::syncApplicationChanges(const ApplicationInfoSeq& applications, const Ice::StringSeq& removed,
+                                 Ice::Long dbSerial)
+{
+    assert(dbSerial != 0);
+    int serial = 0;
+    {
+        Lock sync(*this);
+
+        map<string, ApplicationInfo> oldApplications;
+        try
+        {
+            IceDB::ReadWriteTxn txn(_env);
+
+            Ice::StringSeq changes;
+            for(ApplicationInfoSeq::const_iterator p = applications.begin(); p != applications.end(); ++p)
+            {
+                ApplicationInfo info;
+                if(_applications.get(txn, p->descriptor.name, info))
+                {
+                    oldApplications.insert(make_pair(p->descriptor.name, info));
+                }
+                _applications.put(txn, p->descriptor.name, *p);
+                changes.push_back(p->descriptor.name);
+            }
+            for(Ice::StringSeq::const_iterator p = removed.begin(); p != removed.end(); ++p)
+            {
+                ApplicationInfo info;
+                if(_applications.get(txn, *p, info))
+                {
+                    oldApplications.insert(make_pair(*p, info));
+                    _applications.del(txn, *p);
+                }
+                changes.push_back(*p);
+            }
+            dbSerial = updateSerial(txn, applicationsDbName, dbSerial);
+            logChanges(txn, applicationsDbName, dbSerial, changes);
+
+            txn.commit();
+        }
+        catch(const IceDB::LMDBException& ex)
+        {
+            logError(_communicator, ex);
+            throw;
+        }
+
+        ServerEntrySeq entries;
+        for(ApplicationInfoSeq::const_iterator p = applications.begin(); p != applications.end(); ++p)
+        {
+            try
+            {
+                map<string, ApplicationInfo>::const_iterator q = oldApplications.find(p->descriptor.name);
+                if(q != oldApplications.end())
+                {
+                    ApplicationHelper previous(_communicator, q->second.descriptor);
+                    ApplicationHelper helper(_communicator, p->descriptor);
+                    reload(previous, helper, entries, p->uuid, p->revision, false);
+                }
+                else
+                {
+                    load(ApplicationHelper(_communicator, p->descriptor), entries, p->uuid, p->revision);
+                }
+            }
+            catch(const DeploymentException& ex)
+            {
+                Ice::Warning warn(_traceLevels->logger);
+                warn << "invalid application `" << p->descriptor.name << "':\n" << ex.reason;
+            }
+        }
+
+        for(Ice::StringSeq::const_iterator p = removed.begin(); p != removed.end(); ++p)
+        {
+            map<string, ApplicationInfo>::const_iterator q = oldApplications.find(*p);
+            if(q != oldApplications.end())
+            {
+                unload(ApplicationHelper(_communicator, q->second.descriptor), entries);
+            }
+        }
+
+        for_each(entries.begin(), entries.end(), IceUtil::voidMemFun(&ServerEntry::sync));
+
+        if(_traceLevels->application > 0)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->applicationCat);
+            out << "synchronized applications with " << applications.size() << " added or updated and "
+                << removed.size() << " removed application(s) (serial = `" << dbSerial << "')";
+        }
+
+        serial = _applicationObserverTopic->applicationChanges(dbSerial, applications, removed);
+    }
+    _applicationObserverTopic->waitForSyncedSubscribers(serial);
+}
+
+void
+Database::syncAdapterChanges(const AdapterInfoSeq& adapters, const Ice::StringSeq& removed, Ice::Long dbSerial)
+{
+    assert(dbSerial != 0);
+    int serial = 0;
+    {
+        Lock sync(*this);
+        try
+        {
+            IceDB::ReadWriteTxn txn(_env);
+
+            Ice::StringSeq changes;
+            for(AdapterInfoSeq::const_iterator p = adapters.begin(); p != adapters.end(); ++p)
+            {
+                AdapterInfo info;
+                if(_adapters.get(txn, p->id, info))
+                {
+                    deleteAdapter(txn, info);
+                }
+                addAdapter(txn, *p);
+                changes.push_back(p->id);
+            }
+            for(Ice::StringSeq::const_iterator p = removed.begin(); p != removed.end(); ++p)
+            {
+                AdapterInfo info;
+                if(_adapters.get(txn, *p, info))
+                {
+                    deleteAdapter(txn, info);
+                }
+                changes.push_back(*p);
+            }
+            dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
+            logChanges(txn, adaptersDbName, dbSerial, changes);
+
+            txn.commit();
+        }
+        catch(const IceDB::KeyTooLongException&)
+        {
+            throw;
+        }
+        catch(const IceDB::LMDBException& ex)
+        {
+            logError(_communicator, ex);
+            throw;
+        }
+
+        if(_traceLevels->adapter > 0)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
+            out << "synchronized adapters with " << adapters.size() << " added or updated and " << removed.size()
+                << " removed adapter(s) (serial = `" << dbSerial << "')";
+        }
+
+        serial = _adapterObserverTopic->adapterChanges(dbSerial, adapters, removed);
+    }
+    _adapterObserverTopic->waitForSyncedSubscribers(serial);
+}
+
+void
+Database::syncObjectChanges(const ObjectInfoSeq& objects, const Ice::IdentitySeq& removed, Ice::Long dbSerial)
+{
+    assert(dbSerial != 0);
+    int serial = 0;
+    {
+        Lock sync(*this);
+        try
+        {
+            IceDB::ReadWriteTxn txn(_env);
+
+            Ice::StringSeq changes;
+            for(ObjectInfoSeq::const_iterator p = objects.begin(); p != objects.end(); ++p)
+            {
+                const Ice::Identity id = p->proxy->ice_getIdentity();
+                ObjectInfo info;
+                if(_objects.get(txn, id, info))
+                {
+                    _objectsByType.del(txn, info.type, id);
+                }
+                addObject(txn, *p, false);
+                changes.push_back(_communicator->identityToString(id));
+            }
+            for(Ice::IdentitySeq::const_iterator p = removed.begin(); p != removed.end(); ++p)
+            {
+                ObjectInfo info;
+                if(_objects.get(txn, *p, info))
+                {
+                    deleteObject(txn, info, false);
+                }
+                changes.push_back(_communicator->identityToString(*p));
+            }
+            dbSerial = updateSerial(txn, objectsDbName, dbSerial);
+            logChanges(txn, objectsDbName, dbSerial, changes);
+
+            txn.commit();
+        }
+        catch(const IceDB::LMDBException& ex)
+        {
+            logError(_communicator, ex);
+            throw;
+        }
+
+        if(_traceLevels->object > 0)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
+            out << "synchronized objects with " << objects.size() << " added or updated and " << removed.size()
+                << " removed object(s) (serial = `" << dbSerial << "')";
+        }
+
+        serial = _objectObserverTopic->objectChanges(dbSerial, objects, removed);
     }
     _objectObserverTopic->waitForSyncedSubscribers(serial);
 }
@@ -584,6 +911,13 @@ Database::getSerials() const
     return toMap(txn, _serials);
 }
 
+StringStringDict
+Database::getEpochs() const
+{
+    IceDB::ReadOnlyTxn txn(_env);
+    return toMap(txn, _epochs);
+}
+
 void
 Database::addApplication(const ApplicationInfo& info, AdminSessionI* session, Ice::Long dbSerial)
 {
@@ -1034,6 +1368,7 @@ Database::setAdapterDirectProxy(const string& adapterId, const string& replicaGr
                 deleteAdapter(txn, oldInfo);
             }
             dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
+            logChange(txn, adaptersDbName, dbSerial, adapterId);
 
             txn.commit();
         }
@@ -1134,10 +1469,12 @@ Database::removeAdapter(const string& adapterId)
         {
             IceDB::ReadWriteTxn txn(_env);
 
+            Ice::StringSeq changes;
             AdapterInfo info;
             if(_adapters.get(txn, adapterId, info))
             {
                 deleteAdapter(txn, info);
+                changes.push_back(adapterId);
             }
             else
             {
@@ -1151,9 +1488,11 @@ Database::removeAdapter(const string& adapterId)
                     _adaptersByGroupId.del(txn, p->replicaGroupId, p->id);
                     p->replicaGroupId.clear();
                     addAdapter(txn, *p);
+                    changes.push_back(p->id);
                 }
             }
             dbSerial = updateSerial(txn, adaptersDbName);
+            logChanges(txn, adaptersDbName, dbSerial, changes);
 
             txn.commit();
         }
@@ -1410,6 +1749,12 @@ Database::getAdapterNode(const string& id) const
     return "";
 }
 
+void
+Database::setAdapterLoads(const AdapterLoadDict& loads)
+{
+    _adapterCache.setLoads(loads); // No need to lock the database, the adapter cache has its own load mutex.
+}
+
 Ice::StringSeq
 Database::getAllAdapters(const string& expression)
 {
@@ -1475,6 +1820,7 @@ Database::addObject(const ObjectInfo& info)
             }
             addObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName);
+            logChange(txn, objectsDbName, dbSerial, _communicator->identityToString(id));
 
             txn.commit();
         }
@@ -1524,6 +1870,7 @@ Database::addOrUpdateObject(const ObjectInfo& info, Ice::Long dbSerial)
             }
             addObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
+            logChange(txn, objectsDbName, dbSerial, _communicator->identityToString(id));
 
             txn.commit();
         }
@@ -1577,6 +1924,7 @@ Database::removeObject(const Ice::Identity& id, Ice::Long dbSerial)
             }
             deleteObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
+            logChange(txn, objectsDbName, dbSerial, _communicator->identityToString(id));
 
             txn.commit();
         }
@@ -1627,6 +1975,7 @@ Database::updateObject(const Ice::ObjectPrx& proxy)
             info.proxy = proxy;
             addObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName);
+            logChange(txn, objectsDbName, dbSerial, _communicator->identityToString(id));
 
             txn.commit();
         }
@@ -1653,16 +2002,30 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
     try
     {
         IceDB::ReadWriteTxn txn(_env);
+        Ice::StringSeq changes;
         for(ObjectInfoSeq::const_iterator p = objects.begin(); p != objects.end(); ++p)
         {
             Ice::Identity id = p->proxy->ice_getIdentity();
             ObjectInfo info;
             if(_objects.get(txn, id, info))
             {
+                if(info == *p)
+                {
+                    continue; // Unchanged, the registry is restarted.
+                }
                 _objectsByType.del(txn, info.type, id);
             }
             addObject(txn, *p, false);
+            changes.push_back(_communicator->identityToString(id));
         }
+
+        //
+        // The registry well-known objects don't update the serial, the
+        // changes are logged with the current serial. Only the objects
+        // which changed are logged, the log entry doesn't grow each time
+        // a registry is restarted.
+        //
+        logChanges(txn, objectsDbName, getSerial(txn, objectsDbName), changes);
         txn.commit();
     }
     catch(const IceDB::LMDBException& ex)
@@ -1681,6 +2044,7 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
     try
     {
         IceDB::ReadWriteTxn txn(_env);
+        Ice::StringSeq changes;
         for(ObjectInfoSeq::const_iterator p = objects.begin(); p != objects.end(); ++p)
         {
             Ice::Identity id = p->proxy->ice_getIdentity();
@@ -1688,8 +2052,10 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             if(_objects.get(txn, id, info))
             {
                 deleteObject(txn, info, false);
+                changes.push_back(_communicator->identityToString(id));
             }
         }
+        logChanges(txn, objectsDbName, getSerial(txn, objectsDbName), changes);
         txn.commit();
     }
     catch(const IceDB::LMDBException& ex)
@@ -2317,7 +2683,9 @@ Database::saveApplication(const ApplicationInfo& info, const IceDB::ReadWriteTxn
 {
     assert(dbSerial != 0 || _master);
     _applications.put(txn, info.descriptor.name, info);
-    return updateSerial(txn, applicationsDbName, dbSerial);
+    dbSerial = updateSerial(txn, applicationsDbName, dbSerial);
+    logChange(txn, applicationsDbName, dbSerial, info.descriptor.name);
+    return dbSerial;
 }
 
 Ice::Long
@@ -2325,7 +2693,9 @@ Database::removeApplication(const string& name, const IceDB::ReadWriteTxn& txn,
 {
     assert(dbSerial != 0 || _master);
     _applications.del(txn, name);
-    return updateSerial(txn, applicationsDbName, dbSerial);
+    dbSerial = updateSerial(txn, applicationsDbName, dbSerial);
+    logChange(txn, applicationsDbName, dbSerial, name);
+    return dbSerial;
 }
 
 void
@@ -2716,6 +3086,155 @@ Database::updateSerial(const IceDB::ReadWriteTxn& txn, const string& dbName, Ice
     }
 }
 
+string
+Database::getEpoch(const IceDB::Txn& txn, const string& dbName)
+{
+    string epoch;
+    _epochs.get(txn, dbName, epoch);
+    return epoch;
+}
+
+string
+Database::updateEpoch(const IceDB::ReadWriteTxn& txn, const string& dbName, const string& epoch)
+{
+    //
+    // If the epoch of the database isn't provided by the master, the
+    // database starts a new epoch.
+    //
+    const string dbEpoch = epoch.empty() ? Ice::generateUUID() : epoch;
+    _epochs.put(txn, dbName, dbEpoch);
+    return dbEpoch;
+}
+
+SerialStringSeqMap&
+Database::getChangeLog(const string& dbName)
+{
+    if(dbName == applicationsDbName)
+    {
+        return _applicationChanges;
+    }
+    else if(dbName == adaptersDbName)
+    {
+        return _adapterChanges;
+    }
+    else
+    {
+        assert(dbName == objectsDbName);
+        return _objectChanges;
+    }
+}
+
+void
+Database::logChanges(const IceDB::ReadWriteTxn& txn, const string& dbName, Ice::Long serial,
+                     const Ice::StringSeq& keys)
+{
+    if(serial <= 0 || keys.empty() || _changeLogSize <= 0)
+    {
+        return;
+    }
+
+    SerialStringSeqMap& log = getChangeLog(dbName);
+    SerialKey key = { serial };
+    Ice::StringSeq changes;
+    if(log.get(txn, key, changes))
+    {
+        //
+        // Several updates can be logged with the same serial (the
+        // registry well-known objects), each key is only logged once.
+        //
+        set<string> logged(changes.begin(), changes.end());
+        for(Ice::StringSeq::const_iterator p = keys.begin(); p != keys.end(); ++p)
+        {
+            if(logged.insert(*p).second)
+            {
+                changes.push_back(*p);
+            }
+        }
+        log.put(txn, key, changes);
+    }
+    else
+    {
+        log.put(txn, key, keys);
+    }
+
+    //
+    // Only keep the changes of the last _changeLogSize serials.
+    //
+    IceDB::ReadWriteCursor<SerialKey, Ice::StringSeq, IceDB::IceContext, Ice::OutputStream> cursor(log, txn);
+    while(cursor.get(key, changes, MDB_FIRST) && key.serial <= serial - _changeLogSize)
+    {
+        cursor.del();
+    }
+}
+
+void
+Database::logChange(const IceDB::ReadWriteTxn& txn, const string& dbName, Ice::Long serial, const string& key)
+{
+    logChanges(txn, dbName, serial, Ice::StringSeq(1, key));
+}
+
+void
+Database::clearChanges(const IceDB::ReadWriteTxn& txn, const string& dbName, Ice::Long serial)
+{
+    //
+    // The first entry of the log is the serial from which the log
+    // contains all the changes.
+    //
+    SerialStringSeqMap& log = getChangeLog(dbName);
+    log.clear(txn);
+    if(serial > 0)
+    {
+        SerialKey key = { serial };
+        log.put(txn, key, Ice::StringSeq());
+    }
+}
+
+bool
+Database::getChanges(const IceDB::ReadOnlyTxn& txn, const string& dbName, Ice::Long serial, Ice::StringSeq& keys)
+{
+    const Ice::Long current = getSerial(txn, dbName);
+    if(_changeLogSize <= 0 || serial <= 0 || serial > current)
+    {
+        return false;
+    }
+
+    //
+    // The log contains all the changes following the serial of its
+    // first entry. The changes logged with the given serial are also
+    // included: the changes of the registry well-known objects don't
+    // increment the serial and are logged with the current serial.
+    //
+    set<string> changes;
+    bool first = true;
+    SerialKey key;
+    Ice::StringSeq v;
+    IceDB::ReadOnlyCursor<SerialKey, Ice::StringSeq, IceDB::IceContext, Ice::OutputStream> cursor(
+        getChangeLog(dbName), txn);
+    while(cursor.get(key, v, MDB_NEXT))
+    {
+        if(first)
+        {
+            if(key.serial > serial)
+            {
+                return false; // The log was truncated.
+            }
+            first = false;
+        }
+        if(key.serial >= serial)
+        {
+            changes.insert(v.begin(), v.end());
+        }
+    }
+
+    if(first)
+    {
+        return false;
+    }
+
+    keys.assign(changes.begin(), changes.end());
+    return true;
+}
+
 void
 Database::addAdapter(const IceDB::ReadWriteTxn& txn, const AdapterInfo& info)
 {
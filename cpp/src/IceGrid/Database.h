@@ -41,6 +41,69 @@ typedef IceUtil::Handle<ServerEntry> ServerEntryPtr;
 
 class ApplicationHelper;
 
+//
+// The key of the change logs. It's written in big-endian order so that
+// the log entries are sorted by serial.
+//
+struct SerialKey
+{
+    Ice::Long serial;
+};
+
+}
+
+namespace IceDB
+{
+
+template<>
+struct Codec<IceGrid::SerialKey, IceContext, Ice::OutputStream>
+{
+    static void read(IceGrid::SerialKey& key, const MDB_val& val, const IceContext&)
+    {
+        assert(val.mv_size == sizeof(Ice::Long));
+        const Ice::Byte* p = static_cast<const Ice::Byte*>(val.mv_data);
+        key.serial = 0;
+        for(size_t i = 0; i < sizeof(Ice::Long); ++i)
+        {
+            key.serial = (key.serial << 8) | p[i];
+        }
+    }
+
+    static void write(const IceGrid::SerialKey& key, MDB_val& val, Ice::OutputStream& holder, const IceContext& ctx)
+    {
+        holder.initialize(ctx.communicator, ctx.encoding);
+        holder.b.resize(sizeof(Ice::Long));
+        write(key, &holder.b[0]);
+        val.mv_size = holder.b.size();
+        val.mv_data = &holder.b[0];
+    }
+
+    static bool write(const IceGrid::SerialKey& key, MDB_val& val, const IceContext&)
+    {
+        if(val.mv_size < sizeof(Ice::Long))
+        {
+            val.mv_size = sizeof(Ice::Long);
+            return false;
+        }
+        write(key, static_cast<Ice::Byte*>(val.mv_data));
+        val.mv_size = sizeof(Ice::Long);
+        return true;
+    }
+
+    static void write(const IceGrid::SerialKey& key, Ice::Byte* p)
+    {
+        for(size_t i = 0; i < sizeof(Ice::Long); ++i)
+        {
+            p[i] = static_cast<Ice::Byte>(key.serial >> (8 * (sizeof(Ice::Long) - i - 1)));
+        }
+    }
+};
+
+}
+
+namespace IceGrid
+{
+
 typedef IceDB::Dbi<std::string, IceGrid::ApplicationInfo, IceDB::IceContext, Ice::OutputStream>
     StringApplicationInfoMap;
 
@@ -52,6 +115,8 @@ typedef IceDB::Dbi<std::string, std::string, IceDB::IceContext, Ice::OutputStrea
 
 typedef IceDB::Dbi<std::string, Ice::Long, IceDB::IceContext, Ice::OutputStream> StringLongMap;
 
+typedef IceDB::Dbi<SerialKey, Ice::StringSeq, IceDB::IceContext, Ice::OutputStream> SerialStringSeqMap;
+
 class Database : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
@@ -77,15 +142,23 @@ public:
     int lock(AdminSessionI*, const std::string&);
     void unlock(AdminSessionI*);
 
-    void syncApplications(const ApplicationInfoSeq&, Ice::Long);
-    void syncAdapters(const AdapterInfoSeq&, Ice::Long);
-    void syncObjects(const ObjectInfoSeq&, Ice::Long);
+    void syncApplications(const ApplicationInfoSeq&, Ice::Long, const std::string&);
+    void syncAdapters(const AdapterInfoSeq&, Ice::Long, const std::string&);
+    void syncObjects(const ObjectInfoSeq&, Ice::Long, const std::string&);
+
+    void syncApplicationChanges(const ApplicationInfoSeq&, const Ice::StringSeq&, Ice::Long);
+    void syncAdapterChanges(const AdapterInfoSeq&, const Ice::StringSeq&, Ice::Long);
+    void syncObjectChanges(const ObjectInfoSeq&, const Ice::IdentitySeq&, Ice::Long);
+
+    int subscribeReplicaObserver(TopicName, const DatabaseObserverPrx&, const std::string&, const StringLongDict&,
+                                 const StringStringDict&);
 
     ApplicationInfoSeq getApplications(Ice::Long&);
     AdapterInfoSeq getAdapters(Ice::Long&);
     ObjectInfoSeq getObjects(Ice::Long&);
 
     StringLongDict getSerials() const;
+    StringStringDict getEpochs() const;
 
     void addApplication(const ApplicationInfo&, AdminSessionI*, Ice::Long = 0);
     void updateApplication(const ApplicationUpdateInfo&, bool, AdminSessionI*, Ice::Long = 0);
@@ -127,6 +200,7 @@ public:
     std::string getAdapterServer(const std::string&) const;
     std::string getAdapterApplication(const std::string&) const;
     std::string getAdapterNode(const std::string&) const;
+    void setAdapterLoads(const AdapterLoadDict&);
     Ice::StringSeq getAllAdapters(const std::string& = std::string());
 
     void addObject(const ObjectInfo&);
@@ -187,6 +261,15 @@ private:
     Ice::Long getSerial(const IceDB::Txn&, const std::string&);
     Ice::Long updateSerial(const IceDB::ReadWriteTxn&, const std::string&, Ice::Long = 0);
 
+    std::string getEpoch(const IceDB::Txn&, const std::string&);
+    std::string updateEpoch(const IceDB::ReadWriteTxn&, const std::string&, const std::string& = std::string());
+
+    SerialStringSeqMap& getChangeLog(const std::string&);
+    void logChanges(const IceDB::ReadWriteTxn&, const std::string&, Ice::Long, const Ice::StringSeq&);
+    void logChange(const IceDB::ReadWriteTxn&, const std::string&, Ice::Long, const std::string&);
+    void clearChanges(const IceDB::ReadWriteTxn&, const std::string&, Ice::Long);
+    bool getChanges(const IceDB::ReadOnlyTxn&, const std::string&, Ice::Long, Ice::StringSeq&);
+
     void addAdapter(const IceDB::ReadWriteTxn&, const AdapterInfo&);
     void deleteAdapter(const IceDB::ReadWriteTxn&, const AdapterInfo&);
 
@@ -208,6 +291,7 @@ private:
     const TraceLevelsPtr _traceLevels;
     const bool _master;
     const bool _readonly;
+    const int _changeLogSize;
 
     ReplicaCache _replicaCache;
     NodeCache _nodeCache;
@@ -237,6 +321,11 @@ private:
     StringIdentityMap _internalObjectsByType;
 
     StringLongMap _serials;
+    StringStringMap _epochs;
+
+    SerialStringSeqMap _applicationChanges;
+    SerialStringSeqMap _adapterChanges;
+    SerialStringSeqMap _objectChanges;
 
     RegistryPluginFacadeIPtr _pluginFacade;
 
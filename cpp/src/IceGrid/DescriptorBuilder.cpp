@@ -292,6 +292,12 @@ ApplicationDescriptorBuilder::setLoadBalancing(const XmlAttributesHelper& attrs)
         alb->loadSample = attrs("load-sample", "1");
         policy = alb;
     }
+    else if(type == "latency")
+    {
+        LatencyLoadBalancingPolicyPtr llb = new LatencyLoadBalancingPolicy();
+        llb->selection = attrs("selection", "best");
+        policy = llb;
+    }
     else
     {
         throw invalid_argument("invalid load balancing policy `" + type + "'");
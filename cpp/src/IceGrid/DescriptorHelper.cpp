@@ -223,6 +223,12 @@ struct ReplicaGroupEq : std::binary_function<const ReplicaGroupDescriptor&, cons
             {
                 return false;
             }
+            LatencyLoadBalancingPolicyPtr llhs = LatencyLoadBalancingPolicyPtr::dynamicCast(lhs.loadBalancing);
+            LatencyLoadBalancingPolicyPtr lrhs = LatencyLoadBalancingPolicyPtr::dynamicCast(rhs.loadBalancing);
+            if(llhs && lrhs && llhs->selection != lrhs->selection)
+            {
+                return false;
+            }
         }
         else if(lhs.loadBalancing || rhs.loadBalancing)
         {
@@ -2709,6 +2715,15 @@ ApplicationHelper::ApplicationHelper(const Ice::CommunicatorPtr& communicator,
                     resolve.exception("invalid load sample value (allowed values are 1, 5 or 15)");
                 }
             }
+            LatencyLoadBalancingPolicyPtr ll = LatencyLoadBalancingPolicyPtr::dynamicCast(desc.loadBalancing);
+            if(ll)
+            {
+                ll->selection = resolve(ll->selection, "replica group selection");
+                if(ll->selection != "" && ll->selection != "best" && ll->selection != "two-choices")
+                {
+                    resolve.exception("invalid selection value (allowed values are best or two-choices)");
+                }
+            }
             _instance.replicaGroups.push_back(desc);
         }
 
@@ -3115,6 +3130,10 @@ ApplicationHelper::print(Output& out, const ApplicationInfo& info) const
             {
                 out << "adaptive" ;
             }
+            else if(LatencyLoadBalancingPolicyPtr::dynamicCast(p->loadBalancing))
+            {
+                out << "latency";
+            }
             else
             {
                 out << "<unknown load balancing policy>";
@@ -84,6 +84,25 @@ private:
     Ice::ObjectAdapterPtr _adapter;
 };
 
+class UpdateAdapterLoadsTask : public IceUtil::TimerTask
+{
+public:
+
+    UpdateAdapterLoadsTask(const NodeIPtr& node) : _node(node)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _node->updateAdapterLoads();
+    }
+
+private:
+
+    const NodeIPtr _node;
+};
+
 class CollocatedRegistry : public RegistryI
 {
 public:
@@ -511,6 +530,16 @@ NodeService::startImpl(int argc, char* argv[], int& status)
     //
     _sessions->create(_node);
 
+    //
+    // Periodically report the load of the server adapters to the
+    // registries.
+    //
+    int adapterLoadPeriod = properties->getPropertyAsInt("IceGrid.Node.AdapterLoadPeriod");
+    if(adapterLoadPeriod > 0)
+    {
+        _timer->scheduleRepeated(new UpdateAdapterLoadsTask(_node), IceUtil::Time::seconds(adapterLoadPeriod));
+    }
+
     //
     // Create Admin unless there is a collocated registry with its own Admin
     //
@@ -1030,6 +1030,47 @@ NodeI::dequeueUpdate(const NodeObserverPrx& proxy, const UpdatePtr& update, bool
     }
 }
 
+void
+NodeI::updateAdapterLoads()
+{
+    set<ServerIPtr> servers;
+    {
+        IceUtil::Mutex::Lock sync(_serversLock);
+        for(map<string, set<ServerIPtr> >::const_iterator p = _serversByApplication.begin();
+            p != _serversByApplication.end(); ++p)
+        {
+            servers.insert(p->second.begin(), p->second.end());
+        }
+    }
+
+    for(set<ServerIPtr>::const_iterator p = servers.begin(); p != servers.end(); ++p)
+    {
+        (*p)->updateAdapterLoads();
+    }
+}
+
+void
+NodeI::reportAdapterLoads(const AdapterLoadDict& loads)
+{
+    //
+    // Report the loads to the master and the replicas, the locator of
+    // each registry uses them to order the replicas.
+    //
+    vector<NodeSessionPrx> sessions;
+    {
+        IceUtil::Mutex::Lock sync(_observerMutex);
+        for(map<NodeSessionPrx, NodeObserverPrx>::const_iterator p = _observers.begin(); p != _observers.end(); ++p)
+        {
+            sessions.push_back(p->first);
+        }
+    }
+
+    for(vector<NodeSessionPrx>::const_iterator p = sessions.begin(); p != sessions.end(); ++p)
+    {
+        (*p)->begin_reportAdapterLoads(loads); // Failures are ignored, the next report will be sent anyway.
+    }
+}
+
 void
 NodeI::addServer(const ServerIPtr& server, const string& application)
 {
@@ -132,6 +132,9 @@ public:
     void queueUpdate(const NodeObserverPrx&, const UpdatePtr&);
     void dequeueUpdate(const NodeObserverPrx&, const UpdatePtr&, bool);
 
+    void updateAdapterLoads();
+    void reportAdapterLoads(const AdapterLoadDict&);
+
     void addServer(const ServerIPtr&, const std::string&);
     void removeServer(const ServerIPtr&, const std::string&);
 
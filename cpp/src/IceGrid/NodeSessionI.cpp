@@ -268,6 +268,12 @@ NodeSessionI::waitForApplicationUpdate_async(const AMD_NodeSession_waitForApplic
     _database->waitForApplicationUpdate(cb, application, revision);
 }
 
+void
+NodeSessionI::reportAdapterLoads(const AdapterLoadDict& loads, const Ice::Current&)
+{
+    _database->setAdapterLoads(loads);
+}
+
 void
 NodeSessionI::destroy(const Ice::Current&)
 {
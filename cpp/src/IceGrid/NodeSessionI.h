@@ -61,6 +61,7 @@ public:
     virtual Ice::StringSeq getServers(const Ice::Current&) const;
     virtual void waitForApplicationUpdate_async(const AMD_NodeSession_waitForApplicationUpdatePtr&,
                                                 const std::string&, int, const Ice::Current&) const;
+    virtual void reportAdapterLoads(const AdapterLoadDict&, const Ice::Current&);
     virtual void destroy(const Ice::Current&);
 
     virtual IceUtil::Time timestamp() const;
@@ -475,14 +475,18 @@ RegistryI::startImpl()
 
         try
         {
+            //
+            // The database starts a new epoch, the replicas synchronized
+            // with the previous database get a full synchronization.
+            //
             Ice::Long serial;
             IceGrid::InternalRegistryPrx registry = IceGrid::InternalRegistryPrx::checkedCast(proxy);
             ApplicationInfoSeq applications = registry->getApplications(serial);
-            _database->syncApplications(applications, serial);
+            _database->syncApplications(applications, serial, "");
             AdapterInfoSeq adapters = registry->getAdapters(serial);
-            _database->syncAdapters(adapters, serial);
+            _database->syncAdapters(adapters, serial, "");
             ObjectInfoSeq objects = registry->getObjects(serial);
-            _database->syncObjects(objects, serial);
+            _database->syncObjects(objects, serial, "");
         }
         catch(const Ice::OperationNotExistException&)
         {
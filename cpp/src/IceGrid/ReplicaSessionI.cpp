@@ -92,6 +92,7 @@ ReplicaSessionI::getTimeout(const Ice::Current&) const
 void
 ReplicaSessionI::setDatabaseObserver(const DatabaseObserverPrx& observer,
                                      const IceUtil::Optional<StringLongDict>& slaveSerials,
+                                     const IceUtil::Optional<StringStringDict>& slaveEpochs,
                                      const Ice::Current&)
 {
     //
@@ -142,6 +143,20 @@ ReplicaSessionI::setDatabaseObserver(const DatabaseObserverPrx& observer,
         }
     }
 
+    //
+    // If the slave supports incremental synchronization, it only
+    // receives the updates since its serials if its database epochs
+    // match the master epochs and the master change logs still contain
+    // them.
+    //
+    StringLongDict serials;
+    StringStringDict epochs;
+    if(slaveSerials && slaveEpochs)
+    {
+        serials = *slaveSerials;
+        epochs = *slaveEpochs;
+    }
+
     int serialApplicationObserver;
     int serialAdapterObserver;
     int serialObjectObserver;
@@ -158,9 +173,12 @@ ReplicaSessionI::setDatabaseObserver(const DatabaseObserverPrx& observer,
         }
         _observer = observer;
 
-        serialApplicationObserver = applicationObserver->subscribe(_observer, _info->name);
-        serialAdapterObserver = adapterObserver->subscribe(_observer, _info->name);
-        serialObjectObserver = objectObserver->subscribe(_observer, _info->name);
+        serialApplicationObserver = _database->subscribeReplicaObserver(ApplicationObserverTopicName, _observer,
+                                                                        _info->name, serials, epochs);
+        serialAdapterObserver = _database->subscribeReplicaObserver(AdapterObserverTopicName, _observer,
+                                                                    _info->name, serials, epochs);
+        serialObjectObserver = _database->subscribeReplicaObserver(ObjectObserverTopicName, _observer,
+                                                                   _info->name, serials, epochs);
     }
 
     applicationObserver->waitForSyncedSubscribers(serialApplicationObserver, _info->name);
@@ -31,7 +31,7 @@ public:
     applicationInit(int, const ApplicationInfoSeq& applications, const Ice::Current& current)
     {
         int serial = 0;
-        _database->syncApplications(applications, getSerials(current.ctx, serial));
+        _database->syncApplications(applications, getSerials(current.ctx, serial), getEpoch(current.ctx));
         receivedUpdate(ApplicationObserverTopicName, serial);
     }
 
@@ -95,11 +95,28 @@ public:
         receivedUpdate(ApplicationObserverTopicName, serial, failure);
     }
 
+    virtual void
+    applicationChanges(const ApplicationInfoSeq& applications, const Ice::StringSeq& removed,
+                       const Ice::Current& current)
+    {
+        int serial = 0;
+        _database->syncApplicationChanges(applications, removed, getSerials(current.ctx, serial));
+        receivedUpdate(ApplicationObserverTopicName, serial);
+    }
+
     virtual void
     adapterInit(const AdapterInfoSeq& adapters, const Ice::Current& current)
     {
         int serial = 0;
-        _database->syncAdapters(adapters, getSerials(current.ctx, serial));
+        _database->syncAdapters(adapters, getSerials(current.ctx, serial), getEpoch(current.ctx));
+        receivedUpdate(AdapterObserverTopicName, serial);
+    }
+
+    virtual void
+    adapterChanges(const AdapterInfoSeq& adapters, const Ice::StringSeq& removed, const Ice::Current& current)
+    {
+        int serial = 0;
+        _database->syncAdapterChanges(adapters, removed, getSerials(current.ctx, serial));
         receivedUpdate(AdapterObserverTopicName, serial);
     }
 
@@ -155,7 +172,15 @@ public:
     objectInit(const ObjectInfoSeq& objects, const Ice::Current& current)
     {
         int serial = 0;
-        _database->syncObjects(objects, getSerials(current.ctx, serial));
+        _database->syncObjects(objects, getSerials(current.ctx, serial), getEpoch(current.ctx));
+        receivedUpdate(ObjectObserverTopicName, serial);
+    }
+
+    virtual void
+    objectChanges(const ObjectInfoSeq& objects, const Ice::IdentitySeq& removed, const Ice::Current& current)
+    {
+        int serial = 0;
+        _database->syncObjectChanges(objects, removed, getSerials(current.ctx, serial));
         receivedUpdate(ObjectObserverTopicName, serial);
     }
 
@@ -254,6 +279,13 @@ private:
         }
     }
 
+    string
+    getEpoch(const Ice::Context& context)
+    {
+        Ice::Context::const_iterator p = context.find("dbEpoch");
+        return p != context.end() ? p->second : string();
+    }
+
     void
     receivedUpdate(TopicName name, int serial, const string& failure = string())
     {
@@ -617,7 +649,7 @@ ReplicaSessionManager::createSessionImpl(const InternalRegistryPrx& registry, Ic
         {
             serialsOpt = serials; // Don't provide serials parameter if serials aren't supported.
         }
-        session->setDatabaseObserver(_observer, serialsOpt);
+        session->setDatabaseObserver(_observer, serialsOpt, _database->getEpochs());
         return session;
     }
     catch(const Ice::Exception&)
@@ -822,6 +822,7 @@ ServerI::ServerI(const NodeIPtr& node, const ServerPrx& proxy, const string& ser
     _state(ServerI::Inactive),
     _activation(ServerI::Disabled),
     _failureTime(IceUtil::Time::now(IceUtil::Time::Monotonic)), // Ensure that _activation is init. in updateImpl().
+    _loadTimestamp(0),
     _pid(0)
 {
     assert(_node->getActivator());
@@ -2712,6 +2713,106 @@ ServerI::updateRuntimePropertiesCallback(const Ice::Exception& ex, const Interna
     }
 }
 
+void
+ServerI::updateAdapterLoads()
+{
+    Ice::ProcessPrx process;
+    {
+        Lock sync(*this);
+        if(_state != Active || !_process)
+        {
+            _loadMetrics.clear(); // Don't compute the next load from the samples of a previous process.
+            return;
+        }
+        process = _process;
+    }
+
+    //
+    // Get the dispatch metrics of the server adapters, the IceGrid
+    // metrics view is configured by getProperties().
+    //
+    IceMX::MetricsAdminPrx metrics = IceMX::MetricsAdminPrx::uncheckedCast(process, "Metrics");
+    metrics->begin_getMetricsView("IceGrid", IceMX::newCallback_MetricsAdmin_getMetricsView(this,
+                                                                    &ServerI::adapterLoadsReceived,
+                                                                    &ServerI::adapterLoadsFailed));
+}
+
+void
+ServerI::adapterLoadsReceived(const IceMX::MetricsView& view, Ice::Long timestamp)
+{
+    AdapterLoadDict loads;
+    {
+        Lock sync(*this);
+        if(_state != Active)
+        {
+            return;
+        }
+
+        //
+        // The metrics are grouped by object adapter name. The load is
+        // computed from the difference with the previous sample, the
+        // first sample of an adapter or a sample whose total went down
+        // (the server was restarted) only serve as the next reference.
+        //
+        PropertyDescriptorSeq props;
+        PropertyDescriptorSeqDict::const_iterator s = _desc->properties.find("config");
+        if(s != _desc->properties.end())
+        {
+            props = s->second;
+        }
+        map<string, IceMX::MetricsPtr> previous;
+        previous.swap(_loadMetrics);
+        IceMX::MetricsView::const_iterator p = view.find("Dispatch");
+        if(p != view.end())
+        {
+            for(IceMX::MetricsMap::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+            {
+                const IceMX::MetricsPtr& m = *q;
+                _loadMetrics.insert(make_pair(m->id, m));
+
+                string adapterId = getProperty(props, m->id + ".AdapterId");
+                map<string, IceMX::MetricsPtr>::const_iterator r = previous.find(m->id);
+                if(adapterId.empty() || r == previous.end() || timestamp <= _loadTimestamp ||
+                   m->total < r->second->total)
+                {
+                    continue;
+                }
+
+                Ice::Long total = m->total - r->second->total;
+                Ice::Long lifetime = m->totalLifetime - r->second->totalLifetime;
+                if(total == 0)
+                {
+                    total = m->total;
+                    lifetime = m->totalLifetime;
+                }
+
+                AdapterLoad load;
+                load.requestRate = static_cast<float>(m->total - r->second->total) * 1000.0f /
+                    static_cast<float>(timestamp - _loadTimestamp);
+                load.inFlight = m->current;
+                load.latency = total > 0 ? static_cast<float>(lifetime) / static_cast<float>(total) / 1000.0f : 0.0f;
+                loads.insert(make_pair(adapterId, load));
+            }
+        }
+        _loadTimestamp = timestamp;
+    }
+
+    if(!loads.empty())
+    {
+        _node->reportAdapterLoads(loads);
+    }
+}
+
+void
+ServerI::adapterLoadsFailed(const Ice::Exception&)
+{
+    //
+    // Ignore, the server might be shutting down or its metrics view
+    // might not be enabled (if it was started before the load
+    // reporting was enabled for example).
+    //
+}
+
 bool
 ServerI::checkActivation()
 {
@@ -3199,6 +3300,17 @@ ServerI::getProperties(const InternalServerDescriptorPtr& desc)
         }
     }
 
+    //
+    // Enable the dispatch metrics used to compute the load of the
+    // server adapters, see updateAdapterLoads().
+    //
+    if(desc->processRegistered &&
+       _node->getCommunicator()->getProperties()->getPropertyAsInt("IceGrid.Node.AdapterLoadPeriod") > 0 &&
+       getProperty(props, "IceMX.Metrics.IceGrid.Map.Dispatch.GroupBy").empty())
+    {
+        props.push_back(createProperty("IceMX.Metrics.IceGrid.Map.Dispatch.GroupBy", "parent"));
+    }
+
     //
     // Add the locator proxy property and the node properties override
     //
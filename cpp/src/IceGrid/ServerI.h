@@ -126,6 +126,10 @@ public:
     void updateRuntimePropertiesCallback(const InternalServerDescriptorPtr&);
     void updateRuntimePropertiesCallback(const Ice::Exception&, const InternalServerDescriptorPtr&);
 
+    void updateAdapterLoads();
+    void adapterLoadsReceived(const IceMX::MetricsView&, Ice::Long);
+    void adapterLoadsFailed(const Ice::Exception&);
+
 private:
 
     void updateImpl(const InternalServerDescriptorPtr&);
@@ -175,6 +179,8 @@ private:
     std::string _stdOutFile;
     Ice::StringSeq _logs;
     PropertyDescriptorSeq _properties;
+    Ice::Long _loadTimestamp;
+    std::map<std::string, IceMX::MetricsPtr> _loadMetrics;
 
     DestroyCommandPtr _destroy;
     StopCommandPtr _stop;
@@ -24,8 +24,13 @@ Ice::EncodingVersion encodings[] = {
 
 }
 
-ObserverTopic::ObserverTopic(const IceStorm::TopicManagerPrx& topicManager, const string& name, Ice::Long dbSerial) :
-    _logger(topicManager->ice_getCommunicator()->getLogger()), _serial(0), _dbSerial(dbSerial)
+ObserverTopic::ObserverTopic(const IceStorm::TopicManagerPrx& topicManager, const string& name, Ice::Long dbSerial,
+                             const string& dbEpoch) :
+    _logger(topicManager->ice_getCommunicator()->getLogger()),
+    _serial(0),
+    _dbSerial(dbSerial),
+    _dbEpoch(dbEpoch),
+    _pagingObservers(0)
 {
     for(int i = 0; i < static_cast<int>(sizeof(encodings) / sizeof(Ice::EncodingVersion)); ++i)
     {
@@ -56,40 +61,78 @@ ObserverTopic::~ObserverTopic()
 }
 
 int
-ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
+ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name,
+                         const IceUtil::Optional<Ice::StringSeq>& changes)
 {
-    Lock sync(*this);
-    if(_topics.empty())
+    bool paged = false;
     {
-        return -1;
-    }
-
-    assert(obsv);
-    try
-    {
-        IceStorm::QoS qos;
-        qos["reliability"] = "ordered";
-        Ice::EncodingVersion v = IceInternal::getCompatibleEncoding(obsv->ice_getEncodingVersion());
-        map<Ice::EncodingVersion, IceStorm::TopicPrx>::const_iterator p = _topics.find(v);
-        if(p == _topics.end())
+        Lock sync(*this);
+        if(_topics.empty())
         {
-            Ice::Warning out(_logger);
-            out << "unsupported encoding version for observer `" << obsv << "'";
             return -1;
         }
-        initObserver(p->second->subscribeAndGetPublisher(qos, obsv->ice_twoway()));
-    }
-    catch(const IceStorm::AlreadySubscribed&)
-    {
-        throw ObserverAlreadyRegisteredException(obsv->ice_getIdentity());
+
+        assert(obsv);
+        try
+        {
+            IceStorm::QoS qos;
+            qos["reliability"] = "ordered";
+            Ice::EncodingVersion v = IceInternal::getCompatibleEncoding(obsv->ice_getEncodingVersion());
+            map<Ice::EncodingVersion, IceStorm::TopicPrx>::const_iterator p = _topics.find(v);
+            if(p == _topics.end())
+            {
+                Ice::Warning out(_logger);
+                out << "unsupported encoding version for observer `" << obsv << "'";
+                return -1;
+            }
+            Ice::ObjectPrx publisher = p->second->subscribeAndGetPublisher(qos, obsv->ice_twoway());
+            if(changes)
+            {
+                initObserverChanges(publisher, *changes);
+            }
+            else if(!name.empty())
+            {
+                //
+                // Replica observers always get the whole state with the
+                // init update, they replace their database with it.
+                //
+                initObserver(publisher);
+            }
+            else
+            {
+                paged = initObserverFirstPage(publisher, obsv->ice_getIdentity());
+            }
+        }
+        catch(const IceStorm::AlreadySubscribed&)
+        {
+            throw ObserverAlreadyRegisteredException(obsv->ice_getIdentity());
+        }
+
+        if(!name.empty())
+        {
+            assert(_syncSubscribers.find(name) == _syncSubscribers.end());
+            _syncSubscribers.insert(name);
+            addExpectedUpdate(_serial, name);
+            return _serial;
+        }
     }
 
-    if(!name.empty())
+    //
+    // Send the remaining pages of the observer initial state. The lock is
+    // released after each page and the next page waits for the updates
+    // waiting for the lock, see UpdateLock, so updates are not blocked
+    // while a large state is sent to the observer.
+    //
+    while(paged)
     {
-        assert(_syncSubscribers.find(name) == _syncSubscribers.end());
-        _syncSubscribers.insert(name);
-        addExpectedUpdate(_serial, name);
-        return _serial;
+        Lock sync(*this);
+        ++_pagingObservers;
+        while(_waitingUpdates.load() > 0 && !_topics.empty())
+        {
+            wait();
+        }
+        --_pagingObservers;
+        paged = !_topics.empty() && initObserverNextPage(obsv->ice_getIdentity());
     }
     return -1;
 }
@@ -114,6 +157,8 @@ ObserverTopic::unsubscribe(const Ice::ObjectPrx& observer, const string& name)
 
     assert(observer);
 
+    cancelObserverInit(observer->ice_getIdentity());
+
     if(!name.empty())
     {
         assert(_syncSubscribers.find(name) != _syncSubscribers.end());
@@ -185,6 +230,46 @@ ObserverTopic::waitForSyncedSubscribers(int serial, const string& name)
     waitForSyncedSubscribersNoSync(serial, name);
 }
 
+void
+ObserverTopic::initObserverChanges(const Ice::ObjectPrx& obsv, const Ice::StringSeq&)
+{
+    initObserver(obsv);
+}
+
+bool
+ObserverTopic::initObserverFirstPage(const Ice::ObjectPrx& obsv, const Ice::Identity&)
+{
+    initObserver(obsv);
+    return false;
+}
+
+bool
+ObserverTopic::initObserverNextPage(const Ice::Identity&)
+{
+    return false;
+}
+
+void
+ObserverTopic::cancelObserverInit(const Ice::Identity&)
+{
+}
+
+ObserverTopic::UpdateLock::UpdateLock(ObserverTopic& topic) : _topic(topic)
+{
+    ++_topic._waitingUpdates;
+    _topic.lock();
+    --_topic._waitingUpdates;
+}
+
+ObserverTopic::UpdateLock::~UpdateLock()
+{
+    if(_topic._pagingObservers > 0)
+    {
+        _topic.notifyAll();
+    }
+    _topic.unlock();
+}
+
 int
 ObserverTopic::getSerial() const
 {
@@ -256,13 +341,17 @@ ObserverTopic::waitForSyncedSubscribersNoSync(int serial, const string& name)
 }
 
 void
-ObserverTopic::updateSerial(Ice::Long dbSerial)
+ObserverTopic::updateSerial(Ice::Long dbSerial, const string& dbEpoch)
 {
     ++_serial;
     if(dbSerial > 0)
     {
         _dbSerial = dbSerial;
     }
+    if(!dbEpoch.empty())
+    {
+        _dbEpoch = dbEpoch;
+    }
 }
 
 Ice::Context
@@ -279,6 +368,10 @@ ObserverTopic::getContext(int serial, Ice::Long dbSerial) const
         ostringstream os;
         os << dbSerial;
         context["dbSerial"] = os.str();
+        if(!_dbEpoch.empty())
+        {
+            context["dbEpoch"] = _dbEpoch;
+        }
     }
     return context;
 }
@@ -601,22 +694,23 @@ NodeObserverTopic::isServerEnabled(const string& server) const
 }
 
 ApplicationObserverTopic::ApplicationObserverTopic(const IceStorm::TopicManagerPrx& topicManager,
-                                                   const map<string, ApplicationInfo>& applications, Ice::Long serial) :
-    ObserverTopic(topicManager, "ApplicationObserver", serial),
+                                                   const map<string, ApplicationInfo>& applications, Ice::Long serial,
+                                                   const string& epoch) :
+    ObserverTopic(topicManager, "ApplicationObserver", serial, epoch),
     _applications(applications)
 {
     _publishers = getPublishers<ApplicationObserverPrx>();
 }
 
 int
-ApplicationObserverTopic::applicationInit(Ice::Long dbSerial, const ApplicationInfoSeq& apps)
+ApplicationObserverTopic::applicationInit(Ice::Long dbSerial, const ApplicationInfoSeq& apps, const string& dbEpoch)
 {
     Lock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
-    updateSerial(dbSerial);
+    updateSerial(dbSerial, dbEpoch);
     _applications.clear();
     for(ApplicationInfoSeq::const_iterator p = apps.begin(); p != apps.end(); ++p)
     {
@@ -747,6 +841,46 @@ ApplicationObserverTopic::applicationUpdated(Ice::Long dbSerial, const Applicati
     return _serial;
 }
 
+int
+ApplicationObserverTopic::applicationChanges(Ice::Long dbSerial, const ApplicationInfoSeq& apps,
+                                             const Ice::StringSeq& removed)
+{
+    Lock sync(*this);
+    if(_topics.empty())
+    {
+        return -1;
+    }
+    updateSerial(dbSerial);
+    for(ApplicationInfoSeq::const_iterator p = apps.begin(); p != apps.end(); ++p)
+    {
+        _applications[p->descriptor.name] = *p;
+    }
+    for(Ice::StringSeq::const_iterator p = removed.begin(); p != removed.end(); ++p)
+    {
+        _applications.erase(*p);
+    }
+
+    ApplicationInfoSeq applications;
+    for(map<string, ApplicationInfo>::const_iterator p = _applications.begin(); p != _applications.end(); ++p)
+    {
+        applications.push_back(p->second);
+    }
+    try
+    {
+        for(vector<ApplicationObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
+        {
+            (*p)->applicationInit(_serial, applications, getContext(_serial, dbSerial));
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while publishing `applicationInit' update:\n" << ex;
+    }
+    addExpectedUpdate(_serial);
+    return _serial;
+}
+
 void
 ApplicationObserverTopic::initObserver(const Ice::ObjectPrx& obsv)
 {
@@ -759,23 +893,47 @@ ApplicationObserverTopic::initObserver(const Ice::ObjectPrx& obsv)
     observer->applicationInit(_serial, applications, getContext(_serial, _dbSerial));
 }
 
+void
+ApplicationObserverTopic::initObserverChanges(const Ice::ObjectPrx& obsv, const Ice::StringSeq& changes)
+{
+    DatabaseObserverPrx observer = DatabaseObserverPrx::uncheckedCast(obsv);
+    ApplicationInfoSeq applications;
+    Ice::StringSeq removed;
+    for(Ice::StringSeq::const_iterator p = changes.begin(); p != changes.end(); ++p)
+    {
+        map<string, ApplicationInfo>::const_iterator q = _applications.find(*p);
+        if(q != _applications.end())
+        {
+            applications.push_back(q->second);
+        }
+        else
+        {
+            removed.push_back(*p);
+        }
+    }
+    observer->applicationChanges(applications, removed, getContext(_serial, _dbSerial));
+}
+
 AdapterObserverTopic::AdapterObserverTopic(const IceStorm::TopicManagerPrx& topicManager,
-                                           const map<string, AdapterInfo>& adapters, Ice::Long serial) :
-    ObserverTopic(topicManager, "AdapterObserver", serial),
+                                           const map<string, AdapterInfo>& adapters, Ice::Long serial,
+                                           const string& epoch, int pageSize) :
+    ObserverTopic(topicManager, "AdapterObserver", serial, epoch),
+    _pageSize(pageSize > 0 ? static_cast<size_t>(pageSize) : 0),
     _adapters(adapters)
 {
     _publishers = getPublishers<AdapterObserverPrx>();
 }
 
 int
-AdapterObserverTopic::adapterInit(Ice::Long dbSerial, const AdapterInfoSeq& adpts)
+AdapterObserverTopic::adapterInit(Ice::Long dbSerial, const AdapterInfoSeq& adpts, const string& dbEpoch)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
-    updateSerial(dbSerial);
+    updateSerial(dbSerial, dbEpoch);
+    _inits.clear();
     _adapters.clear();
     for(AdapterInfoSeq::const_iterator q = adpts.begin(); q != adpts.end(); ++q)
     {
@@ -800,12 +958,13 @@ AdapterObserverTopic::adapterInit(Ice::Long dbSerial, const AdapterInfoSeq& adpt
 int
 AdapterObserverTopic::adapterAdded(Ice::Long dbSerial, const AdapterInfo& info)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
     updateSerial(dbSerial);
+    flushObserverInits(info.id);
     _adapters.insert(make_pair(info.id, info));
     try
     {
@@ -826,12 +985,13 @@ AdapterObserverTopic::adapterAdded(Ice::Long dbSerial, const AdapterInfo& info)
 int
 AdapterObserverTopic::adapterUpdated(Ice::Long dbSerial, const AdapterInfo& info)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
     updateSerial(dbSerial);
+    flushObserverInits(info.id);
     _adapters[info.id] = info;
     try
     {
@@ -852,12 +1012,13 @@ AdapterObserverTopic::adapterUpdated(Ice::Long dbSerial, const AdapterInfo& info
 int
 AdapterObserverTopic::adapterRemoved(Ice::Long dbSerial, const string& id)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
     updateSerial(dbSerial);
+    flushObserverInits(id);
     _adapters.erase(id);
     try
     {
@@ -875,6 +1036,46 @@ AdapterObserverTopic::adapterRemoved(Ice::Long dbSerial, const string& id)
     return _serial;
 }
 
+int
+AdapterObserverTopic::adapterChanges(Ice::Long dbSerial, const AdapterInfoSeq& adpts, const Ice::StringSeq& removed)
+{
+    UpdateLock sync(*this);
+    if(_topics.empty())
+    {
+        return -1;
+    }
+    updateSerial(dbSerial);
+    _inits.clear();
+    for(AdapterInfoSeq::const_iterator p = adpts.begin(); p != adpts.end(); ++p)
+    {
+        _adapters[p->id] = *p;
+    }
+    for(Ice::StringSeq::const_iterator p = removed.begin(); p != removed.end(); ++p)
+    {
+        _adapters.erase(*p);
+    }
+
+    AdapterInfoSeq adapters;
+    for(map<string, AdapterInfo>::const_iterator p = _adapters.begin(); p != _adapters.end(); ++p)
+    {
+        adapters.push_back(p->second);
+    }
+    try
+    {
+        for(vector<AdapterObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
+        {
+            (*p)->adapterInit(adapters, getContext(_serial, dbSerial));
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while publishing `adapterInit' update:\n" << ex;
+    }
+    addExpectedUpdate(_serial);
+    return _serial;
+}
+
 void
 AdapterObserverTopic::initObserver(const Ice::ObjectPrx& obsv)
 {
@@ -887,23 +1088,150 @@ AdapterObserverTopic::initObserver(const Ice::ObjectPrx& obsv)
     observer->adapterInit(adapters, getContext(_serial, _dbSerial));
 }
 
+void
+AdapterObserverTopic::initObserverChanges(const Ice::ObjectPrx& obsv, const Ice::StringSeq& changes)
+{
+    DatabaseObserverPrx observer = DatabaseObserverPrx::uncheckedCast(obsv);
+    AdapterInfoSeq adapters;
+    Ice::StringSeq removed;
+    for(Ice::StringSeq::const_iterator p = changes.begin(); p != changes.end(); ++p)
+    {
+        map<string, AdapterInfo>::const_iterator q = _adapters.find(*p);
+        if(q != _adapters.end())
+        {
+            adapters.push_back(q->second);
+        }
+        else
+        {
+            removed.push_back(*p);
+        }
+    }
+    observer->adapterChanges(adapters, removed, getContext(_serial, _dbSerial));
+}
+
+bool
+AdapterObserverTopic::initObserverFirstPage(const Ice::ObjectPrx& obsv, const Ice::Identity& id)
+{
+    if(_pageSize == 0 || _adapters.size() <= _pageSize)
+    {
+        initObserver(obsv);
+        return false;
+    }
+
+    AdapterObserverPrx observer = AdapterObserverPrx::uncheckedCast(obsv);
+    AdapterInfoSeq adapters;
+    for(map<string, AdapterInfo>::const_iterator p = _adapters.begin(); adapters.size() < _pageSize; ++p)
+    {
+        adapters.push_back(p->second);
+    }
+    observer->adapterInit(adapters, getContext(_serial, _dbSerial));
+
+    ObserverInit<string>& init = _inits[id];
+    init.publisher = obsv;
+    init.last = adapters.back().id;
+    return true;
+}
+
+bool
+AdapterObserverTopic::initObserverNextPage(const Ice::Identity& id)
+{
+    map<Ice::Identity, ObserverInit<string> >::iterator p = _inits.find(id);
+    if(p == _inits.end())
+    {
+        return false;
+    }
+
+    ObserverInit<string>& init = p->second;
+    AdapterObserverPrx observer = AdapterObserverPrx::uncheckedCast(init.publisher);
+    map<string, AdapterInfo>::const_iterator q = _adapters.upper_bound(init.last);
+    try
+    {
+        size_t count = 0;
+        while(q != _adapters.end() && count < _pageSize)
+        {
+            init.last = q->first;
+            if(init.sent.erase(q->first) == 0)
+            {
+                observer->adapterAdded(q->second, getContext(_serial, _dbSerial));
+                ++count;
+            }
+            ++q;
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while initializing adapter observer `" << Ice::identityToString(id) << "':\n"
+            << ex;
+        _inits.erase(p);
+        return false;
+    }
+
+    if(q == _adapters.end())
+    {
+        _inits.erase(p);
+        return false;
+    }
+    return true;
+}
+
+void
+AdapterObserverTopic::cancelObserverInit(const Ice::Identity& id)
+{
+    _inits.erase(id);
+}
+
+void
+AdapterObserverTopic::flushObserverInits(const string& id)
+{
+    //
+    // Send the adapter to the observers which didn't get it yet with
+    // their initial state, before they receive its update.
+    //
+    map<string, AdapterInfo>::const_iterator q = _adapters.find(id);
+    for(map<Ice::Identity, ObserverInit<string> >::iterator p = _inits.begin(); p != _inits.end(); ++p)
+    {
+        if(!p->second.isSent(id))
+        {
+            p->second.sent.insert(id);
+            if(q != _adapters.end())
+            {
+                try
+                {
+                    AdapterObserverPrx::uncheckedCast(p->second.publisher)->adapterAdded(q->second,
+                                                                                         getContext(_serial,
+                                                                                                    _dbSerial));
+                }
+                catch(const Ice::LocalException& ex)
+                {
+                    Ice::Warning out(_logger);
+                    out << "unexpected exception while publishing `adapterAdded' update:\n" << ex;
+                }
+            }
+        }
+    }
+}
+
 ObjectObserverTopic::ObjectObserverTopic(const IceStorm::TopicManagerPrx& topicManager,
-                                         const map<Ice::Identity, ObjectInfo>& objects, Ice::Long serial) :
-    ObserverTopic(topicManager, "ObjectObserver", serial),
+                                         const map<Ice::Identity, ObjectInfo>& objects, Ice::Long serial,
+                                         const string& epoch, int pageSize) :
+    ObserverTopic(topicManager, "ObjectObserver", serial, epoch),
+    _pageSize(pageSize > 0 ? static_cast<size_t>(pageSize) : 0),
     _objects(objects)
 {
     _publishers = getPublishers<ObjectObserverPrx>();
 }
 
 int
-ObjectObserverTopic::objectInit(Ice::Long dbSerial, const ObjectInfoSeq& objects)
+ObjectObserverTopic::objectInit(Ice::Long dbSerial, const ObjectInfoSeq& objects, const string& dbEpoch)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
-    updateSerial(dbSerial);
+    updateSerial(dbSerial, dbEpoch);
+    _inits.clear();
     _objects.clear();
     for(ObjectInfoSeq::const_iterator r = objects.begin(); r != objects.end(); ++r)
     {
@@ -928,12 +1256,13 @@ ObjectObserverTopic::objectInit(Ice::Long dbSerial, const ObjectInfoSeq& objects
 int
 ObjectObserverTopic::objectAdded(Ice::Long dbSerial, const ObjectInfo& info)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
     updateSerial(dbSerial);
+    flushObserverInits(info.proxy->ice_getIdentity());
     _objects.insert(make_pair(info.proxy->ice_getIdentity(), info));
     try
     {
@@ -954,12 +1283,13 @@ ObjectObserverTopic::objectAdded(Ice::Long dbSerial, const ObjectInfo& info)
 int
 ObjectObserverTopic::objectUpdated(Ice::Long dbSerial, const ObjectInfo& info)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
     updateSerial(dbSerial);
+    flushObserverInits(info.proxy->ice_getIdentity());
     _objects[info.proxy->ice_getIdentity()] = info;
     try
     {
@@ -980,12 +1310,13 @@ ObjectObserverTopic::objectUpdated(Ice::Long dbSerial, const ObjectInfo& info)
 int
 ObjectObserverTopic::objectRemoved(Ice::Long dbSerial, const Ice::Identity& id)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
     }
     updateSerial(dbSerial);
+    flushObserverInits(id);
     _objects.erase(id);
     try
     {
@@ -1003,10 +1334,50 @@ ObjectObserverTopic::objectRemoved(Ice::Long dbSerial, const Ice::Identity& id)
     return _serial;
 }
 
+int
+ObjectObserverTopic::objectChanges(Ice::Long dbSerial, const ObjectInfoSeq& infos, const Ice::IdentitySeq& removed)
+{
+    UpdateLock sync(*this);
+    if(_topics.empty())
+    {
+        return -1;
+    }
+    updateSerial(dbSerial);
+    _inits.clear();
+    for(ObjectInfoSeq::const_iterator p = infos.begin(); p != infos.end(); ++p)
+    {
+        _objects[p->proxy->ice_getIdentity()] = *p;
+    }
+    for(Ice::IdentitySeq::const_iterator p = removed.begin(); p != removed.end(); ++p)
+    {
+        _objects.erase(*p);
+    }
+
+    ObjectInfoSeq objects;
+    for(map<Ice::Identity, ObjectInfo>::const_iterator p = _objects.begin(); p != _objects.end(); ++p)
+    {
+        objects.push_back(p->second);
+    }
+    try
+    {
+        for(vector<ObjectObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
+        {
+            (*p)->objectInit(objects, getContext(_serial, dbSerial));
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while publishing `objectInit' update:\n" << ex;
+    }
+    addExpectedUpdate(_serial);
+    return _serial;
+}
+
 int
 ObjectObserverTopic::wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq& infos)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
@@ -1015,6 +1386,7 @@ ObjectObserverTopic::wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq& infos)
     for(ObjectInfoSeq::const_iterator p = infos.begin(); p != infos.end(); ++p)
     {
         updateSerial();
+        flushObserverInits(p->proxy->ice_getIdentity());
         map<Ice::Identity, ObjectInfo>::iterator q = _objects.find(p->proxy->ice_getIdentity());
         if(q != _objects.end())
         {
@@ -1062,7 +1434,7 @@ ObjectObserverTopic::wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq& infos)
 int
 ObjectObserverTopic::wellKnownObjectsRemoved(const ObjectInfoSeq& infos)
 {
-    Lock sync(*this);
+    UpdateLock sync(*this);
     if(_topics.empty())
     {
         return -1;
@@ -1071,6 +1443,7 @@ ObjectObserverTopic::wellKnownObjectsRemoved(const ObjectInfoSeq& infos)
     for(ObjectInfoSeq::const_iterator p = infos.begin(); p != infos.end(); ++p)
     {
         updateSerial();
+        flushObserverInits(p->proxy->ice_getIdentity());
         _objects.erase(p->proxy->ice_getIdentity());
         try
         {
@@ -1107,3 +1480,128 @@ ObjectObserverTopic::initObserver(const Ice::ObjectPrx& obsv)
     }
     observer->objectInit(objects, getContext(_serial, _dbSerial));
 }
+
+void
+ObjectObserverTopic::initObserverChanges(const Ice::ObjectPrx& obsv, const Ice::StringSeq& changes)
+{
+    DatabaseObserverPrx observer = DatabaseObserverPrx::uncheckedCast(obsv);
+    ObjectInfoSeq objects;
+    Ice::IdentitySeq removed;
+    for(Ice::StringSeq::const_iterator p = changes.begin(); p != changes.end(); ++p)
+    {
+        Ice::Identity id = Ice::stringToIdentity(*p);
+        map<Ice::Identity, ObjectInfo>::const_iterator q = _objects.find(id);
+        if(q != _objects.end())
+        {
+            objects.push_back(q->second);
+        }
+        else
+        {
+            removed.push_back(id);
+        }
+    }
+    observer->objectChanges(objects, removed, getContext(_serial, _dbSerial));
+}
+
+bool
+ObjectObserverTopic::initObserverFirstPage(const Ice::ObjectPrx& obsv, const Ice::Identity& id)
+{
+    if(_pageSize == 0 || _objects.size() <= _pageSize)
+    {
+        initObserver(obsv);
+        return false;
+    }
+
+    ObjectObserverPrx observer = ObjectObserverPrx::uncheckedCast(obsv);
+    ObjectInfoSeq objects;
+    for(map<Ice::Identity, ObjectInfo>::const_iterator p = _objects.begin(); objects.size() < _pageSize; ++p)
+    {
+        objects.push_back(p->second);
+    }
+    observer->objectInit(objects, getContext(_serial, _dbSerial));
+
+    ObserverInit<Ice::Identity>& init = _inits[id];
+    init.publisher = obsv;
+    init.last = objects.back().proxy->ice_getIdentity();
+    return true;
+}
+
+bool
+ObjectObserverTopic::initObserverNextPage(const Ice::Identity& id)
+{
+    map<Ice::Identity, ObserverInit<Ice::Identity> >::iterator p = _inits.find(id);
+    if(p == _inits.end())
+    {
+        return false;
+    }
+
+    ObserverInit<Ice::Identity>& init = p->second;
+    ObjectObserverPrx observer = ObjectObserverPrx::uncheckedCast(init.publisher);
+    map<Ice::Identity, ObjectInfo>::const_iterator q = _objects.upper_bound(init.last);
+    try
+    {
+        size_t count = 0;
+        while(q != _objects.end() && count < _pageSize)
+        {
+            init.last = q->first;
+            if(init.sent.erase(q->first) == 0)
+            {
+                observer->objectAdded(q->second, getContext(_serial, _dbSerial));
+                ++count;
+            }
+            ++q;
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while initializing object observer `" << Ice::identityToString(id) << "':\n"
+            << ex;
+        _inits.erase(p);
+        return false;
+    }
+
+    if(q == _objects.end())
+    {
+        _inits.erase(p);
+        return false;
+    }
+    return true;
+}
+
+void
+ObjectObserverTopic::cancelObserverInit(const Ice::Identity& id)
+{
+    _inits.erase(id);
+}
+
+void
+ObjectObserverTopic::flushObserverInits(const Ice::Identity& id)
+{
+    //
+    // Send the object to the observers which didn't get it yet with
+    // their initial state, before they receive its update.
+    //
+    map<Ice::Identity, ObjectInfo>::const_iterator q = _objects.find(id);
+    for(map<Ice::Identity, ObserverInit<Ice::Identity> >::iterator p = _inits.begin(); p != _inits.end(); ++p)
+    {
+        if(!p->second.isSent(id))
+        {
+            p->second.sent.insert(id);
+            if(q != _objects.end())
+            {
+                try
+                {
+                    ObjectObserverPrx::uncheckedCast(p->second.publisher)->objectAdded(q->second,
+                                                                                       getContext(_serial,
+                                                                                                  _dbSerial));
+                }
+                catch(const Ice::LocalException& ex)
+                {
+                    Ice::Warning out(_logger);
+                    out << "unexpected exception while publishing `objectAdded' update:\n" << ex;
+                }
+            }
+        }
+    }
+}
@@ -6,6 +6,7 @@
 #define ICEGRID_TOPICS_H
 
 #include <IceUtil/Mutex.h>
+#include <IceUtil/Atomic.h>
 #include <IceStorm/IceStorm.h>
 #include <IceGrid/Internal.h>
 #include <IceGrid/Registry.h>
@@ -14,20 +15,44 @@
 namespace IceGrid
 {
 
+//
+// The state of the initialization of an observer whose initial state is
+// sent in pages. The entries up to and including the last key were sent,
+// the entries with a greater key are sent with the next pages unless they
+// are in the sent set (they were sent before an update).
+//
+template<typename K> struct ObserverInit
+{
+    bool isSent(const K& key) const
+    {
+        return !(last < key) || sent.find(key) != sent.end();
+    }
+
+    Ice::ObjectPrx publisher;
+    K last;
+    std::set<K> sent;
+};
+
 class ObserverTopic : public IceUtil::Monitor<IceUtil::Mutex>, public virtual Ice::Object
 {
 public:
 
-    ObserverTopic(const IceStorm::TopicManagerPrx&, const std::string&, Ice::Long = 0);
+    ObserverTopic(const IceStorm::TopicManagerPrx&, const std::string&, Ice::Long = 0,
+                  const std::string& = std::string());
     virtual ~ObserverTopic();
 
-    int subscribe(const Ice::ObjectPrx&, const std::string& = std::string());
+    int subscribe(const Ice::ObjectPrx&, const std::string& = std::string(),
+                  const IceUtil::Optional<Ice::StringSeq>& = IceUtil::None);
     void unsubscribe(const Ice::ObjectPrx&, const std::string& = std::string());
     void destroy();
 
     void receivedUpdate(const std::string&, int, const std::string&);
 
     virtual void initObserver(const Ice::ObjectPrx&) = 0;
+    virtual void initObserverChanges(const Ice::ObjectPrx&, const Ice::StringSeq&);
+    virtual bool initObserverFirstPage(const Ice::ObjectPrx&, const Ice::Identity&);
+    virtual bool initObserverNextPage(const Ice::Identity&);
+    virtual void cancelObserverInit(const Ice::Identity&);
 
     void waitForSyncedSubscribers(int, const std::string& = std::string());
 
@@ -35,9 +60,27 @@ public:
 
 protected:
 
+    //
+    // Locks the topic monitor to publish an update. The updates have
+    // priority over the pages of the observers initial state, the next
+    // page is only sent once no updates are waiting for the monitor.
+    //
+    class UpdateLock : public IceUtil::noncopyable
+    {
+    public:
+
+        UpdateLock(ObserverTopic&);
+        ~UpdateLock();
+
+    private:
+
+        ObserverTopic& _topic;
+    };
+    friend class UpdateLock;
+
     void addExpectedUpdate(int, const std::string& = std::string());
     void waitForSyncedSubscribersNoSync(int, const std::string& = std::string());
-    void updateSerial(Ice::Long = 0);
+    void updateSerial(Ice::Long = 0, const std::string& = std::string());
     Ice::Context getContext(int, Ice::Long = 0) const;
 
     template<typename T> std::vector<T> getPublishers() const
@@ -55,10 +98,14 @@ protected:
     std::vector<Ice::ObjectPrx> _basePublishers;
     int _serial;
     Ice::Long _dbSerial;
+    std::string _dbEpoch;
 
     std::set<std::string> _syncSubscribers;
     std::map<int, std::set<std::string> > _waitForUpdates;
     std::map<int, std::map<std::string, std::string> > _updateFailures;
+
+    IceUtilInternal::Atomic _waitingUpdates;
+    int _pagingObservers;
 };
 typedef IceUtil::Handle<ObserverTopic> ObserverTopicPtr;
 
@@ -112,14 +159,17 @@ class ApplicationObserverTopic : public ObserverTopic
 {
 public:
 
-    ApplicationObserverTopic(const IceStorm::TopicManagerPrx&, const std::map<std::string, ApplicationInfo>&, Ice::Long);
+    ApplicationObserverTopic(const IceStorm::TopicManagerPrx&, const std::map<std::string, ApplicationInfo>&, Ice::Long,
+                             const std::string&);
 
-    int applicationInit(Ice::Long, const ApplicationInfoSeq&);
+    int applicationInit(Ice::Long, const ApplicationInfoSeq&, const std::string&);
     int applicationAdded(Ice::Long, const ApplicationInfo&);
     int applicationRemoved(Ice::Long, const std::string&);
     int applicationUpdated(Ice::Long, const ApplicationUpdateInfo&);
+    int applicationChanges(Ice::Long, const ApplicationInfoSeq&, const Ice::StringSeq&);
 
     virtual void initObserver(const Ice::ObjectPrx&);
+    virtual void initObserverChanges(const Ice::ObjectPrx&, const Ice::StringSeq&);
 
 private:
 
@@ -132,19 +182,29 @@ class AdapterObserverTopic : public ObserverTopic
 {
 public:
 
-    AdapterObserverTopic(const IceStorm::TopicManagerPrx&, const std::map<std::string, AdapterInfo>&, Ice::Long);
+    AdapterObserverTopic(const IceStorm::TopicManagerPrx&, const std::map<std::string, AdapterInfo>&, Ice::Long,
+                         const std::string&, int);
 
-    int adapterInit(Ice::Long, const AdapterInfoSeq&);
+    int adapterInit(Ice::Long, const AdapterInfoSeq&, const std::string&);
     int adapterAdded(Ice::Long, const AdapterInfo&);
     int adapterUpdated(Ice::Long, const AdapterInfo&);
     int adapterRemoved(Ice::Long, const std::string&);
+    int adapterChanges(Ice::Long, const AdapterInfoSeq&, const Ice::StringSeq&);
 
     virtual void initObserver(const Ice::ObjectPrx&);
+    virtual void initObserverChanges(const Ice::ObjectPrx&, const Ice::StringSeq&);
+    virtual bool initObserverFirstPage(const Ice::ObjectPrx&, const Ice::Identity&);
+    virtual bool initObserverNextPage(const Ice::Identity&);
+    virtual void cancelObserverInit(const Ice::Identity&);
 
 private:
 
+    void flushObserverInits(const std::string&);
+
+    const size_t _pageSize;
     std::vector<AdapterObserverPrx> _publishers;
     std::map<std::string, AdapterInfo> _adapters;
+    std::map<Ice::Identity, ObserverInit<std::string> > _inits;
 };
 typedef IceUtil::Handle<AdapterObserverTopic> AdapterObserverTopicPtr;
 
@@ -152,22 +212,32 @@ class ObjectObserverTopic : public ObserverTopic
 {
 public:
 
-    ObjectObserverTopic(const IceStorm::TopicManagerPrx&, const std::map<Ice::Identity, ObjectInfo>&, Ice::Long);
+    ObjectObserverTopic(const IceStorm::TopicManagerPrx&, const std::map<Ice::Identity, ObjectInfo>&, Ice::Long,
+                        const std::string&, int);
 
-    int objectInit(Ice::Long, const ObjectInfoSeq&);
+    int objectInit(Ice::Long, const ObjectInfoSeq&, const std::string&);
     int objectAdded(Ice::Long, const ObjectInfo&);
     int objectUpdated(Ice::Long, const ObjectInfo&);
     int objectRemoved(Ice::Long, const Ice::Identity&);
+    int objectChanges(Ice::Long, const ObjectInfoSeq&, const Ice::IdentitySeq&);
 
     int wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq&);
     int wellKnownObjectsRemoved(const ObjectInfoSeq&);
 
     virtual void initObserver(const Ice::ObjectPrx&);
+    virtual void initObserverChanges(const Ice::ObjectPrx&, const Ice::StringSeq&);
+    virtual bool initObserverFirstPage(const Ice::ObjectPrx&, const Ice::Identity&);
+    virtual bool initObserverNextPage(const Ice::Identity&);
+    virtual void cancelObserverInit(const Ice::Identity&);
 
 private:
 
+    void flushObserverInits(const Ice::Identity&);
+
+    const size_t _pageSize;
     std::vector<ObjectObserverPrx> _publishers;
     std::map<Ice::Identity, ObjectInfo> _objects;
+    std::map<Ice::Identity, ObserverInit<Ice::Identity> > _inits;
 };
 typedef IceUtil::Handle<ObjectObserverTopic> ObjectObserverTopicPtr;
 
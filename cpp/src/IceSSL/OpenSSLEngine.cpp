@@ -25,6 +25,9 @@
 #include <openssl/err.h>
 #include <openssl/ssl.h>
 #include <openssl/pkcs12.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+#   include <openssl/core_names.h>
+#endif
 
 #ifdef _MSC_VER
 #   pragma warning(disable:4127) // conditional expression is constant
@@ -136,6 +139,21 @@ IceSSL_opensslDHCallback(SSL* ssl, int /*isExport*/, int keyLength)
 }
 #endif
 
+int
+IceSSL_opensslNewSessionCallback(SSL* ssl, SSL_SESSION* session)
+{
+    OpenSSL::SSLEngine* p = reinterpret_cast<OpenSSL::SSLEngine*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), 0));
+    return p->newSession(ssl, session);
+}
+
+int
+IceSSL_opensslTicketKeyCallback(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipherCtx,
+                                ICESSL_OPENSSL_TICKET_MAC_CTX* macCtx, int encrypt)
+{
+    OpenSSL::SSLEngine* p = reinterpret_cast<OpenSSL::SSLEngine*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), 0));
+    return p->ticketKey(ssl, name, iv, cipherCtx, macCtx, encrypt);
+}
+
 }
 
 namespace
@@ -198,7 +216,9 @@ OpenSSL::upCast(OpenSSL::SSLEngine* p)
 
 OpenSSL::SSLEngine::SSLEngine(const CommunicatorPtr& communicator) :
     IceSSL::SSLEngine(communicator),
-    _ctx(0)
+    _ctx(0),
+    _sessionCacheSize(0),
+    _ticketKeyCount(0)
 {
     //
     // Initialize OpenSSL if necessary.
@@ -833,12 +853,50 @@ OpenSSL::SSLEngine::initialize()
         SSL_CTX_set_ex_data(_ctx, 0, this);
 
         //
-        // This is necessary for successful interop with Java. Without it, a Java
-        // client would fail to reestablish a connection: the server gets the
-        // error "session id context uninitialized" and the client receives
-        // "SSLHandshakeException: Remote host closed connection during handshake".
+        // Session resumption is disabled unless IceSSL.SessionCache.Size is set.
+        // The sessions of outgoing connections are kept in our own cache, keyed
+        // by host and remote address, rather than in the OpenSSL cache. Incoming
+        // connections are resumed with session tickets only, no server state is
+        // kept.
         //
-        SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        _sessionCacheSize = properties->getPropertyAsIntWithDefault(propPrefix + "SessionCache.Size", 0);
+        if(_sessionCacheSize > 0)
+        {
+            int timeout = properties->getPropertyAsIntWithDefault(propPrefix + "SessionCache.Timeout", 300);
+            if(timeout <= 0)
+            {
+                throw PluginInitializationException(__FILE__, __LINE__,
+                                                    "IceSSL: invalid value for IceSSL.SessionCache.Timeout");
+            }
+
+            int lifetime = properties->getPropertyAsIntWithDefault(propPrefix + "SessionCache.TicketKeyLifetime",
+                                                                   3600);
+            if(lifetime <= 0)
+            {
+                throw PluginInitializationException(__FILE__, __LINE__,
+                                                    "IceSSL: invalid value for IceSSL.SessionCache.TicketKeyLifetime");
+            }
+            _ticketKeyLifetime = IceUtil::Time::seconds(lifetime);
+
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+            SSL_CTX_sess_set_new_cb(_ctx, IceSSL_opensslNewSessionCallback);
+            SSL_CTX_set_timeout(_ctx, timeout);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+            SSL_CTX_set_tlsext_ticket_key_evp_cb(_ctx, IceSSL_opensslTicketKeyCallback);
+#else
+            SSL_CTX_set_tlsext_ticket_key_cb(_ctx, IceSSL_opensslTicketKeyCallback);
+#endif
+        }
+        else
+        {
+            //
+            // This is necessary for successful interop with Java. Without it, a Java
+            // client would fail to reestablish a connection: the server gets the
+            // error "session id context uninitialized" and the client receives
+            // "SSLHandshakeException: Remote host closed connection during handshake".
+            //
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        }
 
         //
         // Although we disable session caching, we still need to set a session ID
@@ -928,6 +986,7 @@ OpenSSL::SSLEngine::sslErrors() const
 void
 OpenSSL::SSLEngine::destroy()
 {
+    clearSessions();
     if(_ctx)
     {
         SSL_CTX_free(_ctx);
@@ -935,6 +994,215 @@ OpenSSL::SSLEngine::destroy()
     }
 }
 
+bool
+OpenSSL::SSLEngine::sessionCacheEnabled() const
+{
+    return _sessionCacheSize > 0;
+}
+
+void
+OpenSSL::SSLEngine::resumeSession(SSL* ssl, const string& key)
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    map<string, SessionList::iterator>::iterator p = _sessionMap.find(key);
+    if(p == _sessionMap.end())
+    {
+        return;
+    }
+
+    SSL_SESSION* session = p->second->second;
+    if(static_cast<IceUtil::Int64>(SSL_SESSION_get_time(session)) + SSL_SESSION_get_timeout(session) <=
+       IceUtil::Time::now().toSeconds())
+    {
+        SSL_SESSION_free(session);
+        _sessions.erase(p->second);
+        _sessionMap.erase(p);
+        return;
+    }
+
+    //
+    // SSL_set_session takes its own reference on the session.
+    //
+    SSL_set_session(ssl, session);
+
+#ifdef TLS1_3_VERSION
+    //
+    // TLS 1.3 tickets must only be used once, remove the session from the
+    // cache. The server sends new tickets after the handshake, newSession
+    // adds them to the cache.
+    //
+    if(SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION)
+    {
+        SSL_SESSION_free(session);
+        _sessions.erase(p->second);
+        _sessionMap.erase(p);
+    }
+#endif
+}
+
+void
+OpenSSL::SSLEngine::removeSession(const string& key)
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    map<string, SessionList::iterator>::iterator p = _sessionMap.find(key);
+    if(p != _sessionMap.end())
+    {
+        SSL_SESSION_free(p->second->second);
+        _sessions.erase(p->second);
+        _sessionMap.erase(p);
+    }
+}
+
+int
+OpenSSL::SSLEngine::newSession(SSL* ssl, SSL_SESSION* session)
+{
+    OpenSSL::TransceiverI* transceiver = reinterpret_cast<OpenSSL::TransceiverI*>(SSL_get_ex_data(ssl, 0));
+    if(!transceiver || transceiver->_incoming || transceiver->_sessionKey.empty())
+    {
+        return 0;
+    }
+
+    //
+    // Keep the most recent session of each peer, the least recently added
+    // session is evicted when the cache is full. Returning 1 tells OpenSSL we
+    // took ownership of the session.
+    //
+    const string& key = transceiver->_sessionKey;
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    map<string, SessionList::iterator>::iterator p = _sessionMap.find(key);
+    if(p != _sessionMap.end())
+    {
+        SSL_SESSION_free(p->second->second);
+        _sessions.erase(p->second);
+        _sessionMap.erase(p);
+    }
+    else if(_sessionMap.size() >= static_cast<size_t>(_sessionCacheSize))
+    {
+        SSL_SESSION_free(_sessions.back().second);
+        _sessionMap.erase(_sessions.back().first);
+        _sessions.pop_back();
+    }
+    _sessions.push_front(make_pair(key, session));
+    _sessionMap.insert(make_pair(key, _sessions.begin()));
+    return 1;
+}
+
+int
+OpenSSL::SSLEngine::ticketKey(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipherCtx,
+                              ICESSL_OPENSSL_TICKET_MAC_CTX* macCtx, int encrypt)
+{
+    TicketKey key;
+    int status = 1;
+    {
+        IceUtil::Mutex::Lock sync(_sessionMutex);
+        if(_ticketKeyCount == 0 || IceUtil::Time::now(IceUtil::Time::Monotonic) - _ticketKeys[0].created >=
+           _ticketKeyLifetime)
+        {
+            if(!createTicketKey())
+            {
+                return -1;
+            }
+        }
+
+        if(encrypt)
+        {
+            key = _ticketKeys[0];
+        }
+        else
+        {
+            //
+            // Tickets encrypted with the previous key are still accepted, the
+            // client then gets a new ticket encrypted with the current key.
+            // TLS 1.3 tickets are always renewed, the client replaces its
+            // ticket with each new one it receives.
+            //
+            int i = 0;
+            while(i < _ticketKeyCount && memcmp(name, _ticketKeys[i].name, sizeof(key.name)) != 0)
+            {
+                ++i;
+            }
+            if(i == _ticketKeyCount)
+            {
+                return 0; // Unknown key, do a full handshake.
+            }
+            key = _ticketKeys[i];
+#ifdef TLS1_3_VERSION
+            status = i == 0 && SSL_version(ssl) < TLS1_3_VERSION ? 1 : 2;
+#else
+            status = i == 0 ? 1 : 2;
+#endif
+        }
+    }
+
+    if(encrypt)
+    {
+        memcpy(name, key.name, sizeof(key.name));
+        if(RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_128_cbc())) <= 0)
+        {
+            return -1;
+        }
+    }
+
+    if(!EVP_CipherInit_ex(cipherCtx, EVP_aes_128_cbc(), 0, key.aesKey, iv, encrypt))
+    {
+        return -1;
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+    OSSL_PARAM params[3];
+    params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmacKey, sizeof(key.hmacKey));
+    params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0);
+    params[2] = OSSL_PARAM_construct_end();
+    if(!EVP_MAC_CTX_set_params(macCtx, params))
+    {
+        return -1;
+    }
+#else
+    if(!HMAC_Init_ex(macCtx, key.hmacKey, sizeof(key.hmacKey), EVP_sha256(), 0))
+    {
+        return -1;
+    }
+#endif
+    return status;
+}
+
+bool
+OpenSSL::SSLEngine::createTicketKey()
+{
+    //
+    // Called with _sessionMutex locked.
+    //
+    TicketKey key;
+    if(RAND_bytes(key.name, sizeof(key.name)) <= 0 || RAND_bytes(key.aesKey, sizeof(key.aesKey)) <= 0 ||
+       RAND_bytes(key.hmacKey, sizeof(key.hmacKey)) <= 0)
+    {
+        return false;
+    }
+    key.created = IceUtil::Time::now(IceUtil::Time::Monotonic);
+
+    if(_ticketKeyCount > 0)
+    {
+        _ticketKeys[1] = _ticketKeys[0];
+    }
+    _ticketKeys[0] = key;
+    _ticketKeyCount = min(_ticketKeyCount + 1, 2);
+    return true;
+}
+
+void
+OpenSSL::SSLEngine::clearSessions()
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    for(SessionList::const_iterator p = _sessions.begin(); p != _sessions.end(); ++p)
+    {
+        SSL_SESSION_free(p->second);
+    }
+    _sessions.clear();
+    _sessionMap.clear();
+    OPENSSL_cleanse(_ticketKeys, sizeof(_ticketKeys));
+    _ticketKeyCount = 0;
+}
+
 IceInternal::TransceiverPtr
 OpenSSL::SSLEngine::createTransceiver(const InstancePtr& instance,
                                       const IceInternal::TransceiverPtr& delegate,
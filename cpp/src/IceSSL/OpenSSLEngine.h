@@ -10,6 +10,19 @@
 #include <IceSSL/OpenSSLUtil.h>
 
 #include <Ice/BuiltinSequences.h>
+#include <IceUtil/Time.h>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include <list>
+#include <map>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+#   define ICESSL_OPENSSL_TICKET_MAC_CTX EVP_MAC_CTX
+#else
+#   define ICESSL_OPENSSL_TICKET_MAC_CTX HMAC_CTX
+#endif
 
 namespace IceSSL
 {
@@ -37,8 +50,31 @@ public:
     void context(SSL_CTX*);
     std::string sslErrors() const;
 
+    //
+    // TLS session resumption, enabled with IceSSL.SessionCache.Size. Clients
+    // cache a session per host and remote address, servers issue session
+    // tickets encrypted with keys rotated every
+    // IceSSL.SessionCache.TicketKeyLifetime seconds.
+    //
+    bool sessionCacheEnabled() const;
+    void resumeSession(SSL*, const std::string&);
+    void removeSession(const std::string&);
+    int newSession(SSL*, SSL_SESSION*);
+    int ticketKey(SSL*, unsigned char*, unsigned char*, EVP_CIPHER_CTX*, ICESSL_OPENSSL_TICKET_MAC_CTX*, int);
+
 private:
 
+    struct TicketKey
+    {
+        unsigned char name[16];
+        unsigned char aesKey[16];
+        unsigned char hmacKey[32];
+        IceUtil::Time created;
+    };
+
+    bool createTicketKey();
+    void clearSessions();
+
     void cleanup();
     SSL_METHOD* getMethod(int);
     void setOptions(int);
@@ -47,6 +83,16 @@ private:
 
     SSL_CTX* _ctx;
 
+    typedef std::list<std::pair<std::string, SSL_SESSION*> > SessionList;
+
+    IceUtil::Mutex _sessionMutex;
+    int _sessionCacheSize;
+    IceUtil::Time _ticketKeyLifetime;
+    SessionList _sessions; // Most recently added first.
+    std::map<std::string, SessionList::iterator> _sessionMap;
+    TicketKey _ticketKeys[2]; // The current and previous keys.
+    int _ticketKeyCount;
+
 #ifndef OPENSSL_NO_DH
     IceSSL::OpenSSL::DHParamsPtr _dhParams;
 #endif
@@ -206,6 +206,25 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
                 throw SecurityException(__FILE__, __LINE__, "IceSSL: setting SNI host failed `" + _host + "'");
             }
         }
+
+        //
+        // Offer the session of the previous connection to the same peer.
+        //
+        if(!_incoming && _engine->sessionCacheEnabled())
+        {
+            ostringstream os;
+            os << _host;
+            Ice::IPConnectionInfoPtr ipInfo = ICE_DYNAMIC_CAST(Ice::IPConnectionInfo, _delegate->getInfo());
+            if(ipInfo)
+            {
+                os << '/' << ipInfo->remoteAddress << ':' << ipInfo->remotePort;
+            }
+            _sessionKey = os.str();
+            if(!_sessionKey.empty())
+            {
+                _engine->resumeSession(_ssl, _sessionKey);
+            }
+        }
     }
 
     while(!SSL_is_init_finished(_ssl))
@@ -309,6 +328,35 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         }
     }
 
+    _resumed = SSL_session_reused(_ssl) != 0;
+    X509* peerCert = _resumed ? SSL_get_peer_certificate(_ssl) : 0;
+    if(peerCert)
+    {
+        //
+        // The verify callback isn't called for a resumed session, build the
+        // verified chain again from the peer certificates saved with the
+        // session. The verification result of the session still applies.
+        //
+        X509_STORE_CTX* storeCtx = X509_STORE_CTX_new();
+        if(storeCtx && X509_STORE_CTX_init(storeCtx, SSL_CTX_get_cert_store(_engine->context()), peerCert,
+                                           SSL_get_peer_cert_chain(_ssl)))
+        {
+            X509_verify_cert(storeCtx);
+            STACK_OF(X509)* chain = X509_STORE_CTX_get1_chain(storeCtx);
+            if(chain != 0)
+            {
+                _certs.clear();
+                for(int i = 0; i < sk_X509_num(chain); ++i)
+                {
+                    _certs.push_back(OpenSSL::Certificate::create(X509_dup(sk_X509_value(chain, i))));
+                }
+                sk_X509_pop_free(chain, X509_free);
+            }
+        }
+        X509_STORE_CTX_free(storeCtx);
+        X509_free(peerCert);
+    }
+
     long result = SSL_get_verify_result(_ssl);
     if(result != X509_V_OK)
     {
@@ -379,9 +427,11 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
             out << "bits = " << SSL_CIPHER_get_bits(cipher, 0) << "\n";
             out << "protocol = " << SSL_get_version(_ssl) << "\n";
         }
+        out << "session = " << (_resumed ? "resumed" : "new") << "\n";
         out << toString();
     }
 
+    _handshakeComplete = true;
     return IceInternal::SocketOperationNone;
 }
 
@@ -396,6 +446,15 @@ OpenSSL::TransceiverI::closing(bool initiator, const Ice::LocalException&)
 void
 OpenSSL::TransceiverI::close()
 {
+    //
+    // Don't offer the session again if the handshake or the verification of
+    // the peer failed.
+    //
+    if(!_handshakeComplete && !_sessionKey.empty())
+    {
+        _engine->removeSession(_sessionKey);
+    }
+
     if(_ssl)
     {
         int err = SSL_shutdown(_ssl);
@@ -830,6 +889,7 @@ OpenSSL::TransceiverI::getInfo() const
     info->cipher = _cipher;
     info->certs = _certs;
     info->verified = _verified;
+    info->resumed = _resumed;
     return info;
 }
 
@@ -902,6 +962,8 @@ OpenSSL::TransceiverI::TransceiverI(const InstancePtr& instance,
     _delegate(delegate),
     _connected(false),
     _verified(false),
+    _resumed(false),
+    _handshakeComplete(false),
     _ssl(0),
     _memBio(0),
     _sentBytes(0),
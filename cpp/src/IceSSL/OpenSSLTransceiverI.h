@@ -71,6 +71,9 @@ private:
     std::string _cipher;
     std::vector<IceSSL::CertificatePtr> _certs;
     bool _verified;
+    std::string _sessionKey;
+    bool _resumed;
+    bool _handshakeComplete;
 
     SSL* _ssl;
     BIO* _memBio;
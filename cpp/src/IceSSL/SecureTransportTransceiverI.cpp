@@ -553,6 +553,7 @@ IceSSL::SecureTransport::TransceiverI::getInfo() const
     info->cipher = _cipher;
     info->certs = _certs;
     info->verified = _verified;
+    info->resumed = false;
     return info;
 }
 
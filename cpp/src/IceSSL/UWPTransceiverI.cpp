@@ -344,6 +344,7 @@ UWP::TransceiverI::getInfo() const
 {
     ConnectionInfoPtr info = ICE_MAKE_SHARED(ConnectionInfo);
     info->verified = _verified;
+    info->resumed = false;
     info->adapterName = _adapterName;
     info->incoming = _incoming;
     info->underlying = _delegate->getInfo();
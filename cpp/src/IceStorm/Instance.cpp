@@ -107,6 +107,7 @@ Instance::Instance(
     // default one minute.
     _sendTimeout(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.Timeout", 60 * 1000)),
     _sendQueueSizeMax(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.QueueSizeMax", -1)),
+    _sendBatchSizeMax(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.BatchSizeMax", -1)),
     _sendQueueSizeMaxPolicy(RemoveSubscriber),
     _topicReaper(new TopicReaper())
 {
@@ -301,6 +302,12 @@ Instance::sendQueueSizeMax() const
     return _sendQueueSizeMax;
 }
 
+int
+Instance::sendBatchSizeMax() const
+{
+    return _sendBatchSizeMax;
+}
+
 Instance::SendQueueSizeMaxPolicy
 Instance::sendQueueSizeMaxPolicy() const
 {
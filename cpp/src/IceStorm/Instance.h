@@ -88,6 +88,7 @@ public:
     IceUtil::Time flushInterval() const;
     int sendTimeout() const;
     int sendQueueSizeMax() const;
+    int sendBatchSizeMax() const;
     SendQueueSizeMaxPolicy sendQueueSizeMaxPolicy() const;
 
     void shutdown();
@@ -107,6 +108,7 @@ private:
     const IceUtil::Time _flushInterval;
     const int _sendTimeout;
     const int _sendQueueSizeMax;
+    const int _sendBatchSizeMax;
     const SendQueueSizeMaxPolicy _sendQueueSizeMaxPolicy;
     const Ice::ObjectPrx _topicReplicaProxy;
     const Ice::ObjectPrx _publisherReplicaProxy;
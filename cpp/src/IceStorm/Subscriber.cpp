@@ -227,7 +227,7 @@ SubscriberBatch::doFlush()
     }
 
     EventDataSeq v;
-    v.swap(_events);
+    _events.take(v);
     assert(!v.empty());
 
     if(_observer)
@@ -336,7 +336,7 @@ SubscriberOneway::flush()
         // request.
         //
         EventDataPtr e = _events.front();
-        _events.erase(_events.begin());
+        _events.pop_front();
         if(_observer)
         {
             _observer->outstanding(1);
@@ -431,7 +431,7 @@ SubscriberTwoway::flush()
         // request.
         //
         EventDataPtr e = _events.front();
-        _events.erase(_events.begin());
+        _events.pop_front();
         ++_outstanding;
         if(_observer)
         {
@@ -472,27 +472,34 @@ SubscriberLink::flush()
         return;
     }
 
+    //
+    // Forward up to Send.BatchSizeMax events, the remaining events are
+    // forwarded once the forward call completes.
+    //
     EventDataSeq v;
-    v.swap(_events);
-
-    EventDataSeq::iterator p = v.begin();
-    while(p != v.end())
+    while(v.empty() && !_events.empty())
     {
-        if(_rec.cost != 0)
+        _events.take(v, _instance->sendBatchSizeMax());
+
+        EventDataSeq::iterator p = v.begin();
+        while(p != v.end())
         {
-            int cost = 0;
-            Ice::Context::const_iterator q = (*p)->context.find("cost");
-            if(q != (*p)->context.end())
-            {
-                cost = atoi(q->second.c_str());
-            }
-            if(cost > _rec.cost)
+            if(_rec.cost != 0)
             {
-                p = v.erase(p);
-                continue;
+                int cost = 0;
+                Ice::Context::const_iterator q = (*p)->context.find("cost");
+                if(q != (*p)->context.end())
+                {
+                    cost = atoi(q->second.c_str());
+                }
+                if(cost > _rec.cost)
+                {
+                    p = v.erase(p);
+                    continue;
+                }
             }
+            ++p;
         }
-        ++p;
     }
 
     if(!v.empty())
@@ -516,6 +523,71 @@ SubscriberLink::flush()
 
 }
 
+EventQueue::EventQueue(int max) :
+    _max(max > 0 ? static_cast<size_t>(max) : 0),
+    _head(0),
+    _size(0)
+{
+}
+
+void
+EventQueue::push_back(const EventDataPtr& event)
+{
+    assert(!full());
+    if(_size == _buffer.size())
+    {
+        //
+        // The buffer is full, double its capacity without exceeding the
+        // maximum size of the queue and move the events to the front of
+        // the new buffer.
+        //
+        size_t capacity = _buffer.empty() ? 16 : _buffer.size() * 2;
+        if(_max > 0 && capacity > _max)
+        {
+            capacity = _max;
+        }
+        vector<EventDataPtr> buffer(capacity);
+        for(size_t i = 0; i < _size; ++i)
+        {
+            buffer[i].swap(_buffer[(_head + i) % _buffer.size()]);
+        }
+        _buffer.swap(buffer);
+        _head = 0;
+    }
+    _buffer[(_head + _size) % _buffer.size()] = event;
+    ++_size;
+}
+
+void
+EventQueue::pop_front()
+{
+    assert(_size > 0);
+    _buffer[_head] = 0;
+    _head = (_head + 1) % _buffer.size();
+    --_size;
+}
+
+void
+EventQueue::clear()
+{
+    while(_size > 0)
+    {
+        pop_front();
+    }
+    _head = 0;
+}
+
+void
+EventQueue::take(EventDataSeq& events, int max)
+{
+    size_t n = max > 0 ? min(static_cast<size_t>(max), _size) : _size;
+    for(size_t i = 0; i < n; ++i)
+    {
+        events.push_back(front());
+        pop_front();
+    }
+}
+
 SubscriberPtr
 Subscriber::create(
     const InstancePtr& instance,
@@ -682,7 +754,7 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
     {
         for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
         {
-            if(static_cast<int>(_events.size()) == _instance->sendQueueSizeMax())
+            if(_events.full())
             {
                 if(_instance->sendQueueSizeMaxPolicy() == Instance::RemoveSubscriber)
                 {
@@ -967,6 +1039,7 @@ Subscriber::Subscriber(
     _state(SubscriberStateOnline),
     _outstanding(0),
     _outstandingCount(1),
+    _events(instance->sendQueueSizeMax()),
     _currentRetry(0)
 {
     if(_proxy && _instance->publisherReplicaProxy())
@@ -20,6 +20,63 @@ typedef IceUtil::Handle<Instance> InstancePtr;
 class Subscriber;
 typedef IceUtil::Handle<Subscriber> SubscriberPtr;
 
+//
+// The queue of events of a subscriber. The events are stored in a ring
+// buffer whose capacity doubles when it's full, up to the maximum size
+// of the queue (the send queue size limit) if there's one. The buffer
+// is reused once it has grown, queuing and sending an event doesn't
+// allocate memory.
+//
+class EventQueue
+{
+public:
+
+    EventQueue(int);
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    //
+    // Returns true if the queue reached its maximum size, the caller
+    // applies the send queue size limit policy before queuing more
+    // events.
+    //
+    bool full() const
+    {
+        return _max > 0 && _size == _max;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    const EventDataPtr& front() const
+    {
+        assert(_size > 0);
+        return _buffer[_head];
+    }
+
+    void push_back(const EventDataPtr&);
+    void pop_front();
+    void clear();
+
+    //
+    // Move up to max events (all the events if max <= 0) from the
+    // front of the queue to the given sequence.
+    //
+    void take(EventDataSeq&, int = -1);
+
+private:
+
+    const size_t _max;
+    std::vector<EventDataPtr> _buffer;
+    size_t _head;
+    size_t _size;
+};
+
 class Subscriber : public IceUtil::Shared
 {
 public:
@@ -78,7 +135,7 @@ protected:
 
     int _outstanding; // The current number of outstanding responses.
     int _outstandingCount; // The current number of outstanding events when batching events (only used for metrics).
-    EventDataSeq _events; // The queue of events to send.
+    EventQueue _events; // The queue of events to send.
 
     // The next time to try sending a new event if we're offline.
     IceUtil::Time _next;
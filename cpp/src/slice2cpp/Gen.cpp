@@ -73,6 +73,82 @@ isConstexprType(const TypePtr& type)
     }
 }
 
+//
+// Returns true if the data members of the given struct are all fixed-size
+// numeric types, or structs that satisfy the same condition. The C++ layout
+// of such a struct matches its encoding on little-endian platforms when it
+// has no padding, in which case Ice::IsPacked allows sequences of this
+// struct to be marshaled with a single copy.
+//
+bool
+isPackedStruct(const StructPtr& s)
+{
+    if(findMetaData(s->getMetaData(), false) == "%class")
+    {
+        return false;
+    }
+
+    DataMemberList members = s->dataMembers();
+    if(members.empty())
+    {
+        return false;
+    }
+
+    for(DataMemberList::const_iterator i = members.begin(); i != members.end(); ++i)
+    {
+        BuiltinPtr bp = BuiltinPtr::dynamicCast((*i)->type());
+        if(bp)
+        {
+            switch(bp->kind())
+            {
+                case Builtin::KindByte:
+                case Builtin::KindShort:
+                case Builtin::KindInt:
+                case Builtin::KindLong:
+                case Builtin::KindFloat:
+                case Builtin::KindDouble:
+                {
+                    break;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            StructPtr st = StructPtr::dynamicCast((*i)->type());
+            if(!st || !isPackedStruct(st))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+//
+// Generates the Ice::IsPacked specialization of a struct accepted by
+// isPackedStruct. The struct is packed only if it has no padding, which
+// depends on the platform. With cpp:packed, the C++11 mapping asserts it.
+//
+void
+writePackedTraits(Output& H, const StructPtr& p, bool cpp11)
+{
+    string scoped = fixKwd(p->scoped());
+    H << nl << "template<>";
+    H << nl << "struct IsPacked< " << scoped << ">";
+    H << sb;
+    if(cpp11 && p->hasMetaData("cpp:packed"))
+    {
+        H << nl << "static_assert(sizeof(" << scoped << ") == " << p->minWireSize() << ", \"struct "
+          << p->scoped().substr(2) << " has padding and cannot be packed\");";
+    }
+    H << nl << "static const bool value = sizeof(" << scoped << ") == " << p->minWireSize() << ";";
+    H << eb << ";" << nl;
+}
+
 string
 getDeprecateSymbol(const ContainedPtr& p1, const ContainedPtr& p2)
 {
@@ -291,6 +367,43 @@ throwUserExceptionLambda(IceUtilInternal::Output& C, ExceptionList throws, const
     }
 }
 
+//
+// Returns true if the C++11 proxy of the given operation can pass its
+// arguments directly to a collocated servant, see IceInternal::DirectDispatch.
+// The servant must dispatch the operation synchronously and the parameters
+// must have the same mapping on the proxy and servant sides.
+//
+bool
+canDispatchDirectly(const OperationPtr& p)
+{
+    ClassDefPtr cl = ClassDefPtr::dynamicCast(p->container());
+    if(cl->hasMetaData("amd") || p->hasMetaData("amd") || p->hasMarshaledResult() ||
+       p->sendsClasses(false) || p->returnsClasses(false) || !getDeprecateSymbol(p, cl).empty())
+    {
+        return false;
+    }
+
+    list<StringList> metaData;
+    metaData.push_back(p->getMetaData());
+    ParamDeclList params = p->parameters();
+    for(ParamDeclList::const_iterator q = params.begin(); q != params.end(); ++q)
+    {
+        metaData.push_back((*q)->getMetaData());
+    }
+
+    for(list<StringList>::const_iterator q = metaData.begin(); q != metaData.end(); ++q)
+    {
+        for(StringList::const_iterator r = q->begin(); r != q->end(); ++r)
+        {
+            if(r->find("cpp:array") == 0 || r->find("cpp:range") == 0 || r->find("cpp:view-type") == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 string
 resultStructName(const string& name, const string& scope = "", bool marshaledResult = false)
 {
@@ -591,6 +704,101 @@ writeOpDocSummary(Output& out, const OperationPtr& op, const CommentPtr& doc, Op
     out << nl << " */";
 }
 
+//
+// Writes a switch on the characters of the operation name `s'. The operation names
+// in `names' all have the same length and the characters at the positions in `used'
+// are already known. The position with the most distinct characters is used at each
+// step, so that a single string comparison remains.
+//
+void
+writeOperationCharSwitch(Output& out, const vector<pair<string, int> >& names, const set<string::size_type>& used)
+{
+    if(names.size() == 1)
+    {
+        out << nl << "if(s == \"" << names.front().first << "\")";
+        out << sb;
+        out << nl << "return " << names.front().second << ';';
+        out << eb;
+        return;
+    }
+
+    string::size_type position = 0;
+    size_t distinct = 0;
+    for(string::size_type i = 0; i < names.front().first.size(); ++i)
+    {
+        if(used.find(i) == used.end())
+        {
+            set<char> chars;
+            for(vector<pair<string, int> >::const_iterator q = names.begin(); q != names.end(); ++q)
+            {
+                chars.insert(q->first[i]);
+            }
+            if(chars.size() > distinct)
+            {
+                distinct = chars.size();
+                position = i;
+            }
+        }
+    }
+    assert(distinct > 1);
+
+    map<char, vector<pair<string, int> > > byChar;
+    for(vector<pair<string, int> >::const_iterator q = names.begin(); q != names.end(); ++q)
+    {
+        byChar[q->first[position]].push_back(*q);
+    }
+
+    set<string::size_type> positions = used;
+    positions.insert(position);
+
+    out << nl << "switch(s[" << position << "])";
+    out << sb;
+    for(map<char, vector<pair<string, int> > >::const_iterator q = byChar.begin(); q != byChar.end(); ++q)
+    {
+        out << nl << "case '" << q->first << "':";
+        out << sb;
+        writeOperationCharSwitch(out, q->second, positions);
+        out << nl << "break;";
+        out << eb;
+    }
+    out << eb;
+}
+
+//
+// Writes a function that returns the position of an operation name in the sorted
+// list of operation names, or -1 if it's not one of them. The function switches
+// on the length of the name and then on its characters instead of doing a binary
+// search with string comparisons.
+//
+void
+writeOperationIndex(Output& out, const string& name, const StringList& opNames)
+{
+    map<string::size_type, vector<pair<string, int> > > byLength;
+    int index = 0;
+    for(StringList::const_iterator q = opNames.begin(); q != opNames.end(); ++q)
+    {
+        byLength[q->size()].push_back(make_pair(*q, index++));
+    }
+
+    out << sp << nl << "int";
+    out << nl << name << "(const ::std::string& s)";
+    out << sb;
+    out << nl << "switch(s.size())";
+    out << sb;
+    for(map<string::size_type, vector<pair<string, int> > >::const_iterator q = byLength.begin(); q != byLength.end();
+        ++q)
+    {
+        out << nl << "case " << q->first << ':';
+        out << sb;
+        writeOperationCharSwitch(out, q->second, set<string::size_type>());
+        out << nl << "break;";
+        out << eb;
+    }
+    out << eb;
+    out << nl << "return -1;";
+    out << eb;
+}
+
 void
 emitOpNameResult(IceUtilInternal::Output& H, const OperationPtr& p, int useWstring)
 {
@@ -898,6 +1106,7 @@ Slice::Gen::generate(const UnitPtr& p)
         H << "\n#include <Ice/GCObject.h>";
         H << "\n#include <Ice/Value.h>";
         H << "\n#include <Ice/Incoming.h>";
+        H << "\n#include <Ice/DirectDispatch.h>";
         if(p->hasContentsWithMetaData("amd"))
         {
             H << "\n#include <Ice/IncomingAsync.h>";
@@ -3186,21 +3395,10 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
               << getUnqualified("::Ice::Current&", scope) << ");";
             H << nl << "/// \\endcond";
 
-            string flatName = "iceC" + p->flattenedScope() + p->name() + "_all";
+            string flatName = "iceC" + p->flattenedScope() + p->name() + "_operationIndex";
             C << sp << nl << "namespace";
             C << nl << "{";
-            C << nl << "const ::std::string " << flatName << "[] =";
-            C << sb;
-
-            for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end();)
-            {
-                C << nl << '"' << *q << '"';
-                if(++q != allOpNames.end())
-                {
-                    C << ',';
-                }
-            }
-            C << eb << ';';
+            writeOperationIndex(C, flatName, allOpNames);
             C << sp << nl << "}";
             C << sp;
             C << nl << "/// \\cond INTERNAL";
@@ -3208,17 +3406,7 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             C << nl << scoped.substr(2) << "::_iceDispatch(::IceInternal::Incoming& in, const "
               << getUnqualified("::Ice::Current&", scope) << " current)";
             C << sb;
-
-            C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-              << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-              << ", current.operation);";
-            C << nl << "if(r.first == r.second)";
-            C << sb;
-            C << nl << "throw " << getUnqualified("::Ice::OperationNotExistException", scope)
-              << "(__FILE__, __LINE__, current.id, " << "current.facet, current.operation);";
-            C << eb;
-            C << sp;
-            C << nl << "switch(r.first - " << flatName << ')';
+            C << nl << "switch(" << flatName << "(current.operation))";
             C << sb;
             int i = 0;
             for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -3230,7 +3418,6 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             }
             C << nl << "default:";
             C << sb;
-            C << nl << "assert(false);";
             C << nl << "throw " << getUnqualified("::Ice::OperationNotExistException", scope)
               << "(__FILE__, __LINE__, current.id, " << "current.facet, current.operation);";
             C << eb;
@@ -3293,15 +3480,13 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
                   << "::ice_operationAttributes(const ::std::string& opName) const";
                 C << sb;
 
-                C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-                  << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-                  << ", opName);";
-                C << nl << "if(r.first == r.second)";
+                C << nl << "int i = " << flatName << "(opName);";
+                C << nl << "if(i < 0)";
                 C << sb;
                 C << nl << "return -1;";
                 C << eb;
 
-                C << nl << "return " << opAttrFlatName << "[r.first - " << flatName << "];";
+                C << nl << "return " << opAttrFlatName << "[i];";
                 C << eb;
             }
         }
@@ -5328,6 +5513,11 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
         }
         H << eb << ";" << nl;
 
+        if(!classMetaData && isPackedStruct(p))
+        {
+            writePackedTraits(H, p, false);
+        }
+
         writeStreamHelpers(H, p, p->dataMembers(), false, true, false);
     }
     return false;
@@ -5507,6 +5697,17 @@ Slice::Gen::MetaDataVisitor::visitStructStart(const StructPtr& p)
 {
     StringList metaData = validate(p, p->getMetaData(), p->file(), p->line());
     p->setMetaData(metaData);
+
+    if(p->hasMetaData("cpp:packed") && (p->isLocal() || !isPackedStruct(p)))
+    {
+        const UnitPtr ut = p->unit();
+        const DefinitionContextPtr dc = ut->findDefinitionContext(p->file());
+        assert(dc);
+        dc->warning(InvalidMetaData, p->file(), p->line(), "ignoring metadata `cpp:packed' for struct `" +
+                    p->name() + "': data members must be byte, short, int, long, float, double or packed structs");
+        metaData.remove("cpp:packed");
+        p->setMetaData(metaData);
+    }
     return true;
 }
 
@@ -5673,6 +5874,10 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
             {
                 continue;
             }
+            if(StructPtr::dynamicCast(cont) && ss == "packed")
+            {
+                continue;
+            }
 
             {
                 ClassDefPtr cl = ClassDefPtr::dynamicCast(cont);
@@ -5870,6 +6075,7 @@ Slice::Gen::NormalizeMetaDataVisitor::normalize(const StringList& metaData)
         "comparable",
         "const",
         "ice_print",
+        "packed",
         "range",
         "scoped",
         "type:",
@@ -6145,17 +6351,10 @@ Slice::Gen::Cpp11DeclVisitor::visitClassDefStart(const ClassDefPtr& p)
         allOpNames.sort();
         allOpNames.unique();
 
-        C << nl << "const ::std::string iceC" << p->flattenedScope() << p->name() << "_ops[] =";
-        C << sb;
-        for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end();)
+        if(!allOps.empty())
         {
-            C << nl << '"' << *q << '"';
-            if(++q != allOpNames.end())
-            {
-                C << ',';
-            }
+            writeOperationIndex(C, "iceC" + p->flattenedScope() + p->name() + "_operationIndex", allOpNames);
         }
-        C << eb << ';';
     }
 
     return true;
@@ -6956,6 +7155,37 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
     }
     H << nl << deprecateSymbol << retS << ' ' << fixKwd(name) << spar << paramsDecl << contextDecl << epar;
     H << sb;
+    if(canDispatchDirectly(p))
+    {
+        H << nl << "::IceInternal::DirectDispatch _direct(this);";
+        string servantS = getUnqualified(fixKwd(cl->scoped() + (cl->isInterface() ? "" : "Disp")), clScope);
+        H << nl << "if(auto _servant = _direct.servant<" << servantS << ">())";
+        H << sb;
+        H << nl << "try";
+        H << sb;
+        H << nl << (ret ? "return " : "") << "_servant->" << fixKwd(name) << spar;
+        for(ParamDeclList::const_iterator q = paramList.begin(); q != paramList.end(); ++q)
+        {
+            H << fixKwd((*q)->name());
+        }
+        H << ("_direct.current(\"" + name + "\", "
+              + getUnqualified(operationModeToString(p->sendMode(), true), clScope) + ", " + contextParam + ")")
+          << epar << ";";
+        if(!ret)
+        {
+            H << nl << "return;";
+        }
+        H << eb;
+        H << nl << "catch(...)";
+        H << sb;
+        H << nl << "_direct.exception(";
+        H.inc();
+        throwUserExceptionLambda(H, p->throws(), clScope);
+        H.dec();
+        H << ");";
+        H << eb;
+        H << eb;
+    }
     H << nl;
     if(futureOutParams.size() == 1)
     {
@@ -8037,7 +8267,7 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefEnd(const ClassDefPtr& p)
         allOpNames.sort();
         allOpNames.unique();
 
-        string flatName = "iceC" + p->flattenedScope() + p->name() + "_ops";
+        string flatName = "iceC" + p->flattenedScope() + p->name() + "_operationIndex";
 
         H << sp;
         H << nl << "/// \\cond INTERNAL";
@@ -8052,16 +8282,7 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefEnd(const ClassDefPtr& p)
           << getUnqualified("::Ice::Current&", scope) << " current)";
         C << sb;
 
-        C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-          << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-          << ", current.operation);";
-        C << nl << "if(r.first == r.second)";
-        C << sb;
-        C << nl << "throw " << getUnqualified("::Ice::OperationNotExistException", scope)
-          << "(__FILE__, __LINE__, current.id, current.facet, current.operation);";
-        C << eb;
-        C << sp;
-        C << nl << "switch(r.first - " << flatName << ')';
+        C << nl << "switch(" << flatName << "(current.operation))";
         C << sb;
         int i = 0;
         for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -8073,7 +8294,6 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefEnd(const ClassDefPtr& p)
         }
         C << nl << "default:";
         C << sb;
-        C << nl << "assert(false);";
         C << nl << "throw " << getUnqualified("::Ice::OperationNotExistException", scope)
           << "(__FILE__, __LINE__, current.id, current.facet, current.operation);";
         C << eb;
@@ -8883,6 +9103,11 @@ Slice::Gen::Cpp11StreamVisitor::visitStructStart(const StructPtr& p)
     H << nl << "static const bool fixedLength = " << (p->isVariableLength() ? "false" : "true") << ";";
     H << eb << ";" << nl;
 
+    if(isPackedStruct(p))
+    {
+        writePackedTraits(H, p, true);
+    }
+
     writeStreamHelpers(H, p, p->dataMembers(), false, false, true);
 
     return false;
@@ -198,6 +198,40 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+#ifndef _WIN32
+    cout << "testing object adapter with multiple acceptors... " << flush;
+    {
+        communicator->getProperties()->setProperty("AAdapter.Endpoints", helper->getTestEndpoint(10));
+        communicator->getProperties()->setProperty("AAdapter.Acceptors", "4");
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("AAdapter");
+        test(adapter->getEndpoints().size() == 1);
+        test(adapter->getPublishedEndpoints().size() == 1);
+        adapter->activate();
+
+        Ice::Identity id;
+        id.name = "dummy";
+        Ice::ObjectPrxPtr prx = adapter->createProxy(id)->ice_collocationOptimized(false);
+        for(int i = 0; i < 20; ++i)
+        {
+            ostringstream os;
+            os << "connection-" << i;
+            try
+            {
+                prx->ice_connectionId(os.str())->ice_ping();
+                test(false);
+            }
+            catch(const Ice::ObjectNotExistException&)
+            {
+                // Expected, the connection was accepted.
+            }
+        }
+        adapter->destroy();
+        communicator->getProperties()->setProperty("AAdapter.Endpoints", "");
+        communicator->getProperties()->setProperty("AAdapter.Acceptors", "");
+    }
+    cout << "ok" << endl;
+#endif
+
     cout << "deactivating object adapter in the server... " << flush;
     obj->deactivate();
     cout << "ok" << endl;
@@ -2232,6 +2232,62 @@ allTests(Test::TestHelper* helper, bool collocated)
                     }
                 }
                 testController->resumeAdapter();
+
+                //
+                // A canceled request queued behind a partially sent request must
+                // not be sent, even if it was already prepared for sending by a
+                // gathered write.
+                //
+                if(!collocated)
+                {
+                    auto count = p->opBatchCount();
+                    Ice::ByteSeq seq;
+                    seq.resize(10024);
+                    testController->holdAdapter();
+                    while(true)
+                    {
+                        auto s = make_shared<promise<bool>>();
+                        auto f = s->get_future();
+                        p->opWithPayloadAsync(
+                            seq,
+                            [](){},
+                            [](exception_ptr){},
+                            [s](bool value)
+                            {
+                                s->set_value(value);
+                            });
+                        if(f.wait_for(chrono::seconds(0)) != future_status::ready || !f.get())
+                        {
+                            break;
+                        }
+                    }
+
+                    p->opWithPayloadAsync(Ice::ByteSeq(512 * 1024), nullptr);
+
+                    promise<void> promise;
+                    auto cancel = p->opBatchAsync(
+                        [&]()
+                        {
+                            promise.set_value();
+                        },
+                        [&](exception_ptr ex)
+                        {
+                            promise.set_exception(ex);
+                        });
+                    this_thread::sleep_for(chrono::milliseconds(100));
+                    cancel();
+                    try
+                    {
+                        promise.get_future().get();
+                        test(false);
+                    }
+                    catch(const Ice::InvocationCanceledException&)
+                    {
+                    }
+                    testController->resumeAdapter();
+                    p->opBatch();
+                    test(p->waitForBatch(count + 1));
+                }
             }
         }
         cout << "ok" << endl;
@@ -3979,6 +4035,34 @@ allTests(Test::TestHelper* helper, bool collocated)
             {
             }
             testController->resumeAdapter();
+
+            //
+            // A canceled request queued behind a partially sent request must
+            // not be sent, even if it was already prepared for sending by a
+            // gathered write.
+            //
+            if(!collocated)
+            {
+                Ice::Int count = p->opBatchCount();
+                testController->holdAdapter();
+                while(p->begin_opWithPayload(seq)->sentSynchronously());
+                p->begin_opWithPayload(Ice::ByteSeq(512 * 1024));
+                r1 = p->begin_opBatch();
+                test(!r1->isSent());
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+                r1->cancel();
+                try
+                {
+                    p->end_opBatch(r1);
+                    test(false);
+                }
+                catch(const Ice::InvocationCanceledException&)
+                {
+                }
+                testController->resumeAdapter();
+                p->opBatch();
+                test(p->waitForBatch(count + 1));
+            }
         }
     }
     cout << "ok" << endl;
@@ -0,0 +1,14 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+TestSuite(__file__, [
+    ClientServerTestCase(),
+    CollocatedTestCase(),
+    ClientServerTestCase(name="client/server with uring backend",
+                         props={ "Ice.ThreadPool.Client.Backend" : "uring", "Ice.ThreadPool.Server.Backend" : "uring" }),
+    ClientServerTestCase(name="client/server with work-stealing dispatch",
+                         props={ "Ice.ThreadPool.Client.WorkStealing" : 2, "Ice.ThreadPool.Server.WorkStealing" : 2 }),
+    ClientServerTestCase(name="client/server with pinned thread pools",
+                         props={ "Ice.ThreadPool.Client.Affinity" : "0", "Ice.ThreadPool.Server.Affinity" : "0" })
+])
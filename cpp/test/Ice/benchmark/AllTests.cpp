@@ -0,0 +1,553 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <IceUtil/Timer.h>
+#include <TestHelper.h>
+#include <Test.h>
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+//
+// Reports the benchmark results as JSON objects, one per line, on the
+// standard output and appends them to the file set with the
+// Test.Benchmark.Output property, if any.
+//
+class Reporter
+{
+public:
+
+    Reporter(const Ice::PropertiesPtr& properties, const string& transport) :
+        _output(properties->getProperty("Test.Benchmark.Output"))
+    {
+        ostringstream os;
+        os << "\"version\":\"" << ICE_STRING_VERSION << "\",";
+#ifdef ICE_CPP11_MAPPING
+        os << "\"mapping\":\"cpp11\",";
+#else
+        os << "\"mapping\":\"cpp98\",";
+#endif
+        os << "\"transport\":\"" << transport << "\"";
+        string affinity = properties->getProperty("Ice.ThreadPool.Client.Affinity");
+        string numaNode = properties->getProperty("Ice.ThreadPool.Client.NumaNode");
+        if(!affinity.empty())
+        {
+            os << ",\"affinity\":\"" << affinity << "\"";
+        }
+        else if(!numaNode.empty())
+        {
+            os << ",\"numa_node\":" << numaNode;
+        }
+        _common = os.str();
+    }
+
+    void
+    latency(const string& name, vector<IceUtil::Int64>& samples)
+    {
+        test(!samples.empty());
+        sort(samples.begin(), samples.end());
+
+        IceUtil::Int64 total = 0;
+        for(vector<IceUtil::Int64>::const_iterator p = samples.begin(); p != samples.end(); ++p)
+        {
+            total += *p;
+        }
+
+        ostringstream os;
+        os << fixed << setprecision(2);
+        os << "\"operations\":" << samples.size()
+           << ",\"mean_us\":" << static_cast<double>(total) / static_cast<double>(samples.size())
+           << ",\"p50_us\":" << percentile(samples, 0.5)
+           << ",\"p90_us\":" << percentile(samples, 0.9)
+           << ",\"p99_us\":" << percentile(samples, 0.99)
+           << ",\"p999_us\":" << percentile(samples, 0.999)
+           << ",\"max_us\":" << samples.back();
+        write(name, os.str());
+    }
+
+    void
+    throughput(const string& name, int operations, size_t itemsPerOperation, const IceUtil::Time& elapsed)
+    {
+        double seconds = max(elapsed.toSecondsDouble(), 1e-9);
+        ostringstream os;
+        os << fixed << setprecision(2);
+        os << "\"operations\":" << operations
+           << ",\"items_per_operation\":" << itemsPerOperation
+           << ",\"elapsed_ms\":" << elapsed.toMilliSecondsDouble()
+           << ",\"operations_per_s\":" << static_cast<double>(operations) / seconds
+           << ",\"items_per_s\":" << static_cast<double>(operations) * static_cast<double>(itemsPerOperation) / seconds;
+        write(name, os.str());
+    }
+
+private:
+
+    static IceUtil::Int64
+    percentile(const vector<IceUtil::Int64>& samples, double p)
+    {
+        size_t index = static_cast<size_t>(p * static_cast<double>(samples.size()));
+        return samples[min(index, samples.size() - 1)];
+    }
+
+    void
+    write(const string& name, const string& values)
+    {
+        ostringstream os;
+        os << "{\"benchmark\":\"" << name << "\"," << _common << "," << values << "}";
+        cout << os.str() << endl;
+        if(!_output.empty())
+        {
+            ofstream out(_output.c_str(), ios::app);
+            test(out);
+            out << os.str() << endl;
+        }
+    }
+
+    const string _output;
+    string _common;
+};
+
+IceUtil::Time
+now()
+{
+    return IceUtil::Time::now(IceUtil::Time::Monotonic);
+}
+
+class NoopTask : public IceUtil::TimerTask
+{
+public:
+
+    virtual void
+    runTimerTask()
+    {
+    }
+};
+
+//
+// Schedules and cancels timer tasks, as connections do around each read
+// and write with a timeout.
+//
+class ScheduleThread : public IceUtil::Thread
+{
+public:
+
+    ScheduleThread(const IceUtil::TimerPtr& timer, int iterations) :
+        _timer(timer),
+        _iterations(iterations)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        vector<IceUtil::TimerTaskPtr> tasks;
+        for(int i = 0; i < tasksPerIteration; ++i)
+        {
+            tasks.push_back(ICE_MAKE_SHARED(NoopTask));
+        }
+
+        for(int i = 0; i < _iterations; ++i)
+        {
+            for(vector<IceUtil::TimerTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+            {
+                _timer->schedule(*p, IceUtil::Time::seconds(60));
+            }
+            for(vector<IceUtil::TimerTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+            {
+                test(_timer->cancel(*p));
+            }
+        }
+    }
+
+    static const int tasksPerIteration = 10;
+
+private:
+
+    const IceUtil::TimerPtr _timer;
+    const int _iterations;
+};
+
+//
+// Measure the time taken by the given number of threads to schedule and
+// cancel tasks while the timer already holds the given number of tasks.
+//
+IceUtil::Time
+scheduleAndCancel(const IceUtil::TimerPtr& timer, int threads, int iterations, int pending)
+{
+    vector<IceUtil::TimerTaskPtr> pendingTasks;
+    for(int i = 0; i < pending; ++i)
+    {
+        pendingTasks.push_back(ICE_MAKE_SHARED(NoopTask));
+        timer->schedule(pendingTasks.back(), IceUtil::Time::seconds(60 + i % 60));
+    }
+
+    vector<IceUtil::ThreadControl> controls;
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < threads; ++i)
+    {
+        IceUtil::ThreadPtr thread = new ScheduleThread(timer, iterations);
+        controls.push_back(thread->start());
+    }
+    for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+    {
+        p->join();
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    timer->destroy();
+    return elapsed;
+}
+
+//
+// Wait for the server to dispatch the given number of oneway pings.
+//
+void
+waitForPings(const Test::BenchmarkPrxPtr& benchmark, int count)
+{
+    int received = benchmark->getPingCount();
+    while(received < count)
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1));
+        received += benchmark->getPingCount();
+    }
+    test(received == count);
+}
+
+}
+
+Test::BenchmarkPrxPtr
+allTests(Test::TestHelper* helper, bool collocated)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    Ice::PropertiesPtr properties = communicator->getProperties();
+
+    const int iterations = properties->getPropertyAsIntWithDefault("Test.Benchmark.Iterations", 1000);
+    const int sequenceSize = properties->getPropertyAsIntWithDefault("Test.Benchmark.SequenceSize", 1000);
+    const int byteSequenceSize = properties->getPropertyAsIntWithDefault("Test.Benchmark.ByteSequenceSize", 100000);
+    const int batchSize = properties->getPropertyAsIntWithDefault("Test.Benchmark.BatchSize", 100);
+    const int timerThreads = properties->getPropertyAsIntWithDefault("Test.Benchmark.TimerThreads", 4);
+    const int timerTasks = properties->getPropertyAsIntWithDefault("Test.Benchmark.TimerTasks", 10000);
+    const int handshakes = properties->getPropertyAsIntWithDefault("Test.Benchmark.Handshakes", 100);
+    test(iterations > 0 && sequenceSize > 0 && byteSequenceSize > 0 && batchSize > 0);
+    test(timerThreads > 0 && timerTasks >= 0 && handshakes > 0);
+
+    Reporter reporter(properties, collocated ? string("collocated") : helper->getTestProtocol());
+
+    Test::BenchmarkPrxPtr benchmark =
+        ICE_CHECKED_CAST(Test::BenchmarkPrx, communicator->stringToProxy("benchmark:" + helper->getTestEndpoint()));
+    test(benchmark);
+
+    //
+    // Establish the connection and warm up the client and server before
+    // taking any measurement.
+    //
+    for(int i = 0; i < max(iterations / 10, 1); ++i)
+    {
+        benchmark->ping();
+    }
+    test(benchmark->getPingCount() == max(iterations / 10, 1));
+
+    cout << "testing twoway latency... " << flush;
+    {
+        vector<IceUtil::Int64> samples;
+        samples.reserve(static_cast<size_t>(iterations));
+        for(int i = 0; i < iterations; ++i)
+        {
+            IceUtil::Time start = now();
+            benchmark->ping();
+            samples.push_back((now() - start).toMicroSeconds());
+        }
+        test(benchmark->getPingCount() == iterations);
+        cout << "ok" << endl;
+        reporter.latency("twoway-latency", samples);
+    }
+
+    if(!collocated)
+    {
+        cout << "testing twoway latency with metrics... " << flush;
+
+        //
+        // Same as above with a metrics view that filters and groups the
+        // invocations, compare with twoway-latency to measure the cost of
+        // the metrics observers.
+        //
+        Ice::InitializationData initData;
+        initData.properties = properties->clone();
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("Ice.Admin.Facets", "Metrics");
+        initData.properties->setProperty("IceMX.Metrics.Benchmark.GroupBy", "operation");
+        initData.properties->setProperty("IceMX.Metrics.Benchmark.Accept.operation", "ping|ice_ping");
+        initData.properties->setProperty("IceMX.Metrics.Benchmark.Reject.identity", ".*/admin");
+        Ice::CommunicatorHolder ich(initData);
+        Test::BenchmarkPrxPtr obj =
+            ICE_UNCHECKED_CAST(Test::BenchmarkPrx, ich->stringToProxy(communicator->proxyToString(benchmark)));
+        obj->ice_ping();
+
+        vector<IceUtil::Int64> samples;
+        samples.reserve(static_cast<size_t>(iterations));
+        for(int i = 0; i < iterations; ++i)
+        {
+            IceUtil::Time start = now();
+            obj->ping();
+            samples.push_back((now() - start).toMicroSeconds());
+        }
+        test(benchmark->getPingCount() == iterations);
+        cout << "ok" << endl;
+        reporter.latency("twoway-latency-metrics", samples);
+    }
+
+    cout << "testing oneway throughput... " << flush;
+    {
+        Test::BenchmarkPrxPtr oneway = benchmark->ice_oneway();
+        IceUtil::Time start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            oneway->ping();
+        }
+        waitForPings(benchmark, iterations);
+        IceUtil::Time elapsed = now() - start;
+        cout << "ok" << endl;
+        reporter.throughput("oneway-throughput", iterations, 1, elapsed);
+    }
+
+    cout << "testing batch oneway throughput... " << flush;
+    {
+        Test::BenchmarkPrxPtr batchOneway = benchmark->ice_batchOneway();
+        IceUtil::Time start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            batchOneway->ping();
+            if((i + 1) % batchSize == 0)
+            {
+                batchOneway->ice_flushBatchRequests();
+            }
+        }
+        batchOneway->ice_flushBatchRequests();
+        waitForPings(benchmark, iterations);
+        IceUtil::Time elapsed = now() - start;
+        cout << "ok" << endl;
+        reporter.throughput("batch-oneway-throughput", iterations, 1, elapsed);
+    }
+
+    cout << "testing AMI pipelining... " << flush;
+    {
+        const int depths[] = { 1, 8, 64 };
+        const size_t count = sizeof(depths) / sizeof(*depths);
+        vector<IceUtil::Time> elapsed;
+        for(size_t d = 0; d < count; ++d)
+        {
+            const size_t depth = static_cast<size_t>(depths[d]);
+#ifdef ICE_CPP11_MAPPING
+            deque<future<void>> pending;
+#else
+            deque<Ice::AsyncResultPtr> pending;
+#endif
+            IceUtil::Time start = now();
+            for(int i = 0; i < iterations; ++i)
+            {
+                if(pending.size() == depth)
+                {
+#ifdef ICE_CPP11_MAPPING
+                    pending.front().get();
+#else
+                    benchmark->end_ping(pending.front());
+#endif
+                    pending.pop_front();
+                }
+#ifdef ICE_CPP11_MAPPING
+                pending.push_back(benchmark->pingAsync());
+#else
+                pending.push_back(benchmark->begin_ping());
+#endif
+            }
+            while(!pending.empty())
+            {
+#ifdef ICE_CPP11_MAPPING
+                pending.front().get();
+#else
+                benchmark->end_ping(pending.front());
+#endif
+                pending.pop_front();
+            }
+            elapsed.push_back(now() - start);
+            test(benchmark->getPingCount() == iterations);
+        }
+        cout << "ok" << endl;
+
+        for(size_t d = 0; d < count; ++d)
+        {
+            ostringstream name;
+            name << "ami-pipelining-" << depths[d];
+            reporter.throughput(name.str(), iterations, 1, elapsed[d]);
+        }
+    }
+
+    cout << "testing byte sequence throughput... " << flush;
+    {
+        Ice::ByteSeq bytes(static_cast<size_t>(byteSequenceSize), 0x5a);
+        pair<const Ice::Byte*, const Ice::Byte*> inSeq(&bytes[0], &bytes[0] + bytes.size());
+
+        IceUtil::Time start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            benchmark->sendBytes(inSeq);
+        }
+        IceUtil::Time sendElapsed = now() - start;
+
+        start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            test(benchmark->recvBytes(byteSequenceSize).size() == bytes.size());
+        }
+        IceUtil::Time recvElapsed = now() - start;
+        cout << "ok" << endl;
+        reporter.throughput("send-byte-seq", iterations, bytes.size(), sendElapsed);
+        reporter.throughput("recv-byte-seq", iterations, bytes.size(), recvElapsed);
+    }
+
+    cout << "testing struct sequence throughput... " << flush;
+    {
+        Test::FixedSeq seq(static_cast<size_t>(sequenceSize));
+        for(size_t i = 0; i < seq.size(); ++i)
+        {
+            seq[i].i = static_cast<Ice::Int>(i);
+            seq[i].j = static_cast<Ice::Int>(i) + 1;
+            seq[i].k = static_cast<Ice::Int>(i) + 2;
+            seq[i].d = static_cast<Ice::Double>(i) * 0.5;
+        }
+
+        IceUtil::Time start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            benchmark->sendFixed(seq);
+        }
+        IceUtil::Time sendElapsed = now() - start;
+
+        start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            test(benchmark->recvFixed(sequenceSize).size() == seq.size());
+        }
+        IceUtil::Time recvElapsed = now() - start;
+        cout << "ok" << endl;
+        reporter.throughput("send-struct-seq", iterations, seq.size(), sendElapsed);
+        reporter.throughput("recv-struct-seq", iterations, seq.size(), recvElapsed);
+    }
+
+    cout << "testing string sequence throughput... " << flush;
+    {
+        Ice::StringSeq seq;
+        for(int i = 0; i < sequenceSize; ++i)
+        {
+            ostringstream os;
+            os << "string-" << i;
+            seq.push_back(os.str());
+        }
+
+        IceUtil::Time start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            benchmark->sendStrings(seq);
+        }
+        IceUtil::Time sendElapsed = now() - start;
+
+        start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            test(benchmark->recvStrings(sequenceSize).size() == seq.size());
+        }
+        IceUtil::Time recvElapsed = now() - start;
+        cout << "ok" << endl;
+        reporter.throughput("send-string-seq", iterations, seq.size(), sendElapsed);
+        reporter.throughput("recv-string-seq", iterations, seq.size(), recvElapsed);
+    }
+
+    cout << "testing class sequence throughput... " << flush;
+    {
+        Test::NodeSeq seq;
+        for(int i = 0; i < sequenceSize; ++i)
+        {
+            ostringstream os;
+            os << "node-" << i;
+            seq.push_back(ICE_MAKE_SHARED(Test::Node, i, os.str()));
+        }
+
+        IceUtil::Time start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            benchmark->sendNodes(seq);
+        }
+        IceUtil::Time sendElapsed = now() - start;
+
+        start = now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            test(benchmark->recvNodes(sequenceSize).size() == seq.size());
+        }
+        IceUtil::Time recvElapsed = now() - start;
+        cout << "ok" << endl;
+        reporter.throughput("send-class-seq", iterations, seq.size(), sendElapsed);
+        reporter.throughput("recv-class-seq", iterations, seq.size(), recvElapsed);
+    }
+
+    if(!collocated && helper->getTestProtocol() == "ssl")
+    {
+        cout << "testing TLS handshake throughput... " << flush;
+
+        //
+        // Each operation establishes a new connection, with a full handshake
+        // or resuming the session of the previous connection.
+        //
+        IceUtil::Time elapsed[2];
+        for(int resume = 0; resume < 2; ++resume)
+        {
+            Ice::InitializationData initData;
+            initData.properties = properties->clone();
+            initData.properties->setProperty("IceSSL.SessionCache.Size", resume ? "1" : "0");
+            Ice::CommunicatorHolder ich(initData);
+            Ice::ObjectPrxPtr obj = ich->stringToProxy(communicator->proxyToString(benchmark));
+            obj->ice_ping();
+            obj->ice_getConnection()->close(ICE_SCOPED_ENUM(Ice::ConnectionClose, GracefullyWithWait));
+
+            IceUtil::Time start = now();
+            for(int i = 0; i < handshakes; ++i)
+            {
+                obj->ice_ping();
+                obj->ice_getConnection()->close(ICE_SCOPED_ENUM(Ice::ConnectionClose, GracefullyWithWait));
+            }
+            elapsed[resume] = now() - start;
+        }
+        cout << "ok" << endl;
+        reporter.throughput("tls-handshake", handshakes, 1, elapsed[0]);
+        reporter.throughput("tls-handshake-resumed", handshakes, 1, elapsed[1]);
+    }
+
+    cout << "testing timer schedule and cancel throughput... " << flush;
+    {
+        //
+        // Compare the ordered timer with the timing wheel used with
+        // Ice.TimerTick. Each operation schedules and cancels a task.
+        //
+        const int operations = timerThreads * iterations * ScheduleThread::tasksPerIteration;
+        IceUtil::Time orderedElapsed = scheduleAndCancel(new IceUtil::Timer(), timerThreads, iterations, timerTasks);
+
+        Ice::InitializationData initData;
+        initData.properties = properties->clone();
+        initData.properties->setProperty("Ice.TimerTick", "10");
+        Ice::CommunicatorHolder ich(initData);
+        IceUtil::Time wheelElapsed = scheduleAndCancel(IceInternal::getInstanceTimer(ich.communicator()),
+                                                       timerThreads, iterations, timerTasks);
+        cout << "ok" << endl;
+        reporter.throughput("timer-schedule-cancel", operations, 1, orderedElapsed);
+        reporter.throughput("timer-wheel-schedule-cancel", operations, 1, wheelElapsed);
+    }
+
+    return benchmark;
+}
@@ -0,0 +1,31 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestHelper.h>
+#include <TestI.h>
+
+using namespace std;
+
+class Collocated : public Test::TestHelper
+{
+public:
+
+    void run(int, char**);
+};
+
+void
+Collocated::run(int argc, char** argv)
+{
+    Ice::CommunicatorHolder communicator = initialize(argc, argv);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(ICE_MAKE_SHARED(BenchmarkI), Ice::stringToIdentity("benchmark"));
+    //adapter->activate(); // Collocated test doesn't need to activate the OA
+
+    Test::BenchmarkPrxPtr allTests(Test::TestHelper*, bool);
+    allTests(this, true);
+}
+
+DEFINE_TEST(Collocated)
@@ -0,0 +1,138 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+namespace
+{
+
+//
+// The sequences returned by the recv operations are cached to measure
+// the marshaling of the reply rather than the creation of the sequence.
+//
+template<typename T, typename F> const T&
+resize(T& seq, Ice::Int size, F create)
+{
+    if(seq.size() != static_cast<size_t>(size))
+    {
+        seq.clear();
+        seq.reserve(static_cast<size_t>(size));
+        for(Ice::Int i = 0; i < size; ++i)
+        {
+            seq.push_back(create(i));
+        }
+    }
+    return seq;
+}
+
+Ice::Byte
+createByte(Ice::Int i)
+{
+    return static_cast<Ice::Byte>(i);
+}
+
+Test::Fixed
+createFixed(Ice::Int i)
+{
+    Test::Fixed f;
+    f.i = i;
+    f.j = i + 1;
+    f.k = i + 2;
+    f.d = i * 0.5;
+    return f;
+}
+
+string
+createString(Ice::Int i)
+{
+    ostringstream os;
+    os << "string-" << i;
+    return os.str();
+}
+
+Test::NodePtr
+createNode(Ice::Int i)
+{
+    return ICE_MAKE_SHARED(Test::Node, i, createString(i));
+}
+
+}
+
+BenchmarkI::BenchmarkI() :
+    _pingCount(0)
+{
+}
+
+void
+BenchmarkI::ping(const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    ++_pingCount;
+}
+
+void
+BenchmarkI::sendBytes(ICE_IN(pair<const Ice::Byte*, const Ice::Byte*>), const Ice::Current&)
+{
+}
+
+Ice::ByteSeq
+BenchmarkI::recvBytes(Ice::Int size, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return resize(_bytes, size, createByte);
+}
+
+void
+BenchmarkI::sendFixed(ICE_IN(Test::FixedSeq), const Ice::Current&)
+{
+}
+
+Test::FixedSeq
+BenchmarkI::recvFixed(Ice::Int size, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return resize(_fixed, size, createFixed);
+}
+
+void
+BenchmarkI::sendStrings(ICE_IN(Ice::StringSeq), const Ice::Current&)
+{
+}
+
+Ice::StringSeq
+BenchmarkI::recvStrings(Ice::Int size, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return resize(_strings, size, createString);
+}
+
+void
+BenchmarkI::sendNodes(ICE_IN(Test::NodeSeq), const Ice::Current&)
+{
+}
+
+Test::NodeSeq
+BenchmarkI::recvNodes(Ice::Int size, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return resize(_nodes, size, createNode);
+}
+
+Ice::Int
+BenchmarkI::getPingCount(const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    Ice::Int count = _pingCount;
+    _pingCount = 0;
+    return count;
+}
+
+void
+BenchmarkI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
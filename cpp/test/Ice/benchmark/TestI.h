@@ -0,0 +1,44 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+#include <IceUtil/Mutex.h>
+
+class BenchmarkI : public virtual Test::Benchmark, private IceUtil::Mutex
+{
+public:
+
+    BenchmarkI();
+
+    virtual void ping(const Ice::Current&);
+
+    virtual void sendBytes(ICE_IN(std::pair<const Ice::Byte*, const Ice::Byte*>), const Ice::Current&);
+    virtual Ice::ByteSeq recvBytes(Ice::Int, const Ice::Current&);
+
+    virtual void sendFixed(ICE_IN(Test::FixedSeq), const Ice::Current&);
+    virtual Test::FixedSeq recvFixed(Ice::Int, const Ice::Current&);
+
+    virtual void sendStrings(ICE_IN(Ice::StringSeq), const Ice::Current&);
+    virtual Ice::StringSeq recvStrings(Ice::Int, const Ice::Current&);
+
+    virtual void sendNodes(ICE_IN(Test::NodeSeq), const Ice::Current&);
+    virtual Test::NodeSeq recvNodes(Ice::Int, const Ice::Current&);
+
+    virtual Ice::Int getPingCount(const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+
+private:
+
+    Ice::Int _pingCount;
+    Ice::ByteSeq _bytes;
+    Test::FixedSeq _fixed;
+    Ice::StringSeq _strings;
+    Test::NodeSeq _nodes;
+};
+
+#endif
@@ -0,0 +1,20 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+#
+# The benchmark results are printed as JSON objects, one per line. Use
+# --cprops="Test.Benchmark.Output=<file>" to also append them to a file,
+# for example to compare the results of two Ice releases.
+#
+# The "pinned thread pools" test case binds the client and server thread
+# pools to the CPUs of the first NUMA node, compare its results with the
+# client/server test case to measure the effect of thread affinity.
+#
+TestSuite(__file__, [
+    ClientServerTestCase(),
+    CollocatedTestCase(),
+    ClientServerTestCase(name="client/server with pinned thread pools",
+                         props={ "Ice.ThreadPool.Client.NumaNode" : 0, "Ice.ThreadPool.Server.NumaNode" : 0 }),
+], options = { "ipv6" : [False], "compress" : [False], "serialize" : [False], "mx" : [False],
+               "protocol" : ["tcp", "ws", "ssl"] }, multihost=False)
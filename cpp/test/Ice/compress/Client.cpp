@@ -0,0 +1,285 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <Ice/Compressor.h>
+#include <IceUtil/Mutex.h>
+#include <TestHelper.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+class LoggerI : public Ice::Logger,
+                private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+              , public std::enable_shared_from_this<LoggerI>
+#endif
+{
+public:
+
+    virtual void
+    print(const string&)
+    {
+    }
+
+    virtual void
+    trace(const string&, const string& message)
+    {
+        Lock sync(*this);
+        _messages.push_back(message);
+    }
+
+    virtual void
+    warning(const string& message)
+    {
+        Lock sync(*this);
+        _messages.push_back(message);
+    }
+
+    virtual void
+    error(const string&)
+    {
+    }
+
+    virtual string
+    getPrefix()
+    {
+        return "";
+    }
+
+    virtual Ice::LoggerPtr
+    cloneWithPrefix(const string&)
+    {
+        return ICE_SHARED_FROM_THIS;
+    }
+
+    bool
+    contains(const string& s)
+    {
+        Lock sync(*this);
+        for(vector<string>::const_iterator p = _messages.begin(); p != _messages.end(); ++p)
+        {
+            if(p->find(s) != string::npos)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void
+    clear()
+    {
+        Lock sync(*this);
+        _messages.clear();
+    }
+
+private:
+
+    vector<string> _messages;
+};
+ICE_DEFINE_PTR(LoggerIPtr, LoggerI);
+
+class EchoI : public Ice::Blobject
+{
+public:
+
+    virtual bool
+    ice_invoke(ICE_IN(vector<Byte>) inEncaps, vector<Byte>& outEncaps, const Current&)
+    {
+        outEncaps = inEncaps;
+        return true;
+    }
+};
+
+//
+// Marshal a payload representative of typical requests: strings,
+// integers and doubles with some redundancy.
+//
+vector<Byte>
+createPayload(const CommunicatorPtr& communicator, int count)
+{
+    OutputStream out(communicator);
+    out.startEncapsulation();
+    out.writeSize(count);
+    for(int i = 0; i < count; ++i)
+    {
+        ostringstream os;
+        os << "item-" << i;
+        out.write(os.str());
+        out.write(i);
+        out.write(static_cast<Double>(i) * 1.5);
+    }
+    out.endEncapsulation();
+    vector<Byte> payload;
+    out.finished(payload);
+    return payload;
+}
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    void run(int, char**);
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+
+    const int iterations = 50;
+    vector<Byte> payload = createPayload(communicator.communicator(), 10000);
+
+    vector<string> compressors;
+    for(Byte status = compressionStatusBZip2; status <= compressionStatusZstd; ++status)
+    {
+        const Compressor* compressor = getCompressor(status);
+        if(!compressor)
+        {
+            continue;
+        }
+        compressors.push_back(compressor->name());
+
+        cout << "testing " << compressor->name() << " compressor... " << flush;
+        test(compressor->status() == status);
+        test(getCompressor(compressor->name()) == compressor);
+        test(status == compressionStatusBZip2 || (getSupportedCompressors() & compressorMask(status)));
+
+        vector<Byte> compressed(compressor->compressBound(payload.size()));
+        vector<Byte> uncompressed(payload.size());
+        size_t compressedSize = 0;
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int i = 0; i < iterations; ++i)
+        {
+            compressedSize = compressor->compress(&payload[0], payload.size(), &compressed[0], compressed.size(), 1);
+        }
+        IceUtil::Time compressTime = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int i = 0; i < iterations; ++i)
+        {
+            test(compressor->uncompress(&compressed[0], compressedSize, &uncompressed[0], uncompressed.size()) ==
+                 payload.size());
+        }
+        IceUtil::Time uncompressTime = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+        test(uncompressed == payload);
+
+        try
+        {
+            compressor->uncompress(&compressed[0], compressedSize / 2, &uncompressed[0], uncompressed.size());
+            test(false);
+        }
+        catch(const Ice::CompressionException&)
+        {
+        }
+        cout << "ok" << endl;
+
+        double mb = static_cast<double>(payload.size() * iterations) / (1024 * 1024);
+        cout << "  ratio = " << static_cast<double>(compressedSize) / static_cast<double>(payload.size())
+             << ", compress = " << mb / compressTime.toSecondsDouble() << " MB/s"
+             << ", uncompress = " << mb / uncompressTime.toSecondsDouble() << " MB/s" << endl;
+    }
+
+    if(compressors.empty())
+    {
+        return;
+    }
+
+    for(vector<string>::const_iterator p = compressors.begin(); p != compressors.end(); ++p)
+    {
+        cout << "testing compressed invocations with " << *p << "... " << flush;
+        Ice::InitializationData initData;
+        initData.properties = properties->clone();
+        initData.properties->setProperty("Ice.Compression.Compressor", *p);
+        initData.properties->setProperty("Ice.Trace.Protocol", "1");
+        initData.properties->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+        LoggerIPtr logger = ICE_MAKE_SHARED(LoggerI);
+        initData.logger = logger;
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("TestAdapter");
+        Ice::ObjectPrxPtr echo = adapter->add(ICE_MAKE_SHARED(EchoI), Ice::stringToIdentity("echo"));
+        adapter->activate();
+        echo = echo->ice_compress(true)->ice_collocationOptimized(false);
+
+        vector<Byte> outEncaps;
+        test(echo->ice_invoke("echo", ICE_ENUM(OperationMode, Normal), payload, outEncaps));
+        test(outEncaps == payload);
+
+        if(*p != "bzip2")
+        {
+            test(logger->contains("compressed with " + *p + "; compress response"));
+        }
+        else
+        {
+            test(logger->contains("(compressed; compress response"));
+        }
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "testing compression threshold... " << flush;
+        Ice::InitializationData initData;
+        initData.properties = properties->clone();
+        initData.properties->setProperty("Ice.Compression.Threshold", "1000000");
+        initData.properties->setProperty("Ice.Trace.Protocol", "1");
+        initData.properties->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+        LoggerIPtr logger = ICE_MAKE_SHARED(LoggerI);
+        initData.logger = logger;
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("TestAdapter");
+        Ice::ObjectPrxPtr echo = adapter->add(ICE_MAKE_SHARED(EchoI), Ice::stringToIdentity("echo"));
+        adapter->activate();
+        echo = echo->ice_compress(true)->ice_collocationOptimized(false);
+
+        vector<Byte> outEncaps;
+        test(echo->ice_invoke("echo", ICE_ENUM(OperationMode, Normal), payload, outEncaps));
+        test(outEncaps == payload);
+        test(logger->contains("(not compressed; compress response"));
+        test(!logger->contains("(compressed"));
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "testing invalid compression settings... " << flush;
+        Ice::InitializationData initData;
+        initData.properties = properties->clone();
+        initData.properties->setProperty("Ice.Compression.Compressor", "unknown");
+        initData.properties->setProperty("Ice.Compression.Threshold", "-1");
+        initData.properties->setProperty("Ice.Trace.Protocol", "1");
+        initData.properties->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+        LoggerIPtr logger = ICE_MAKE_SHARED(LoggerI);
+        initData.logger = logger;
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+        test(logger->contains("unsupported compressor `unknown'"));
+
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("TestAdapter");
+        Ice::ObjectPrxPtr echo = adapter->add(ICE_MAKE_SHARED(EchoI), Ice::stringToIdentity("echo"));
+        adapter->activate();
+        echo = echo->ice_compress(true)->ice_collocationOptimized(false);
+
+        //
+        // The unsupported compressor falls back to bzip2 and the negative
+        // threshold to 0, even small messages are compressed.
+        //
+        vector<Byte> small = createPayload(communicator.communicator(), 1);
+        vector<Byte> outEncaps;
+        test(echo->ice_invoke("echo", ICE_ENUM(OperationMode, Normal), small, outEncaps));
+        test(outEncaps == small);
+        test(logger->contains("(compressed; compress response"));
+        cout << "ok" << endl;
+    }
+}
+
+DEFINE_TEST(Client)
@@ -0,0 +1,287 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <Ice/IPEndpointI.h>
+#include <IceUtil/Thread.h>
+#include <TestHelper.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Stub lookup which resolves stub.host to the test host and fails for any
+// other host. A lookup can be held to check the concurrent lookups.
+//
+class LookupI : public EndpointHostResolver::Lookup, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    LookupI(const string& address) :
+        _address(address)
+    {
+    }
+
+    virtual vector<Address>
+    lookup(const string& host, ProtocolSupport protocol, bool preferIPv6)
+    {
+        Lock sync(*this);
+        ++_lookups[host];
+        notifyAll();
+        while(_held.find(host) != _held.end())
+        {
+            wait();
+        }
+
+        if(host != "stub.host")
+        {
+            throw DNSException(__FILE__, __LINE__, 0, host);
+        }
+        return getAddresses(_address, 0, protocol, ICE_ENUM(EndpointSelectionType, Ordered), preferIPv6, false);
+    }
+
+    int
+    lookups(const string& host)
+    {
+        Lock sync(*this);
+        map<string, int>::const_iterator p = _lookups.find(host);
+        return p == _lookups.end() ? 0 : p->second;
+    }
+
+    void
+    waitForLookup(const string& host)
+    {
+        Lock sync(*this);
+        while(_lookups.find(host) == _lookups.end())
+        {
+            wait();
+        }
+    }
+
+    void
+    hold(const string& host)
+    {
+        Lock sync(*this);
+        _held.insert(host);
+    }
+
+    void
+    release(const string& host)
+    {
+        Lock sync(*this);
+        _held.erase(host);
+        notifyAll();
+    }
+
+private:
+
+    const string _address;
+    map<string, int> _lookups;
+    set<string> _held;
+};
+typedef IceUtil::Handle<LookupI> LookupIPtr;
+
+class ConnectThread : public IceUtil::Thread
+{
+public:
+
+    ConnectThread(const ObjectPrxPtr& proxy) :
+        _proxy(proxy),
+        _connected(false)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        try
+        {
+            if(_proxy->ice_getConnection())
+            {
+                _connected = true;
+            }
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+    }
+
+    bool
+    connected() const
+    {
+        return _connected;
+    }
+
+private:
+
+    const ObjectPrxPtr _proxy;
+    bool _connected;
+};
+typedef IceUtil::Handle<ConnectThread> ConnectThreadPtr;
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    void run(int, char**);
+
+private:
+
+    CommunicatorPtr createCommunicator(const PropertiesPtr&, int, int, const LookupIPtr&);
+    ObjectPrxPtr createProxy(const CommunicatorPtr&, const string&, const string&);
+};
+
+CommunicatorPtr
+Client::createCommunicator(const PropertiesPtr& properties, int threads, int cacheTimeout, const LookupIPtr& lookup)
+{
+    InitializationData initData;
+    initData.properties = properties->clone();
+    initData.properties->setProperty("Ice.RetryIntervals", "-1");
+    {
+        ostringstream os;
+        os << threads;
+        initData.properties->setProperty("Ice.HostResolver.Threads", os.str());
+    }
+    {
+        ostringstream os;
+        os << cacheTimeout;
+        initData.properties->setProperty("Ice.HostResolver.CacheTimeout", os.str());
+    }
+    CommunicatorPtr communicator = Ice::initialize(initData);
+    setHostLookup(communicator, lookup);
+    return communicator;
+}
+
+ObjectPrxPtr
+Client::createProxy(const CommunicatorPtr& communicator, const string& host, const string& connectionId)
+{
+    ostringstream os;
+    os << "test:" << getTestProtocol() << " -h " << host << " -p " << getTestPort();
+    return communicator->stringToProxy(os.str())->ice_connectionId(connectionId);
+}
+
+void
+Client::run(int argc, char** argv)
+{
+    PropertiesPtr properties = createTestProperties(argc, argv);
+    CommunicatorHolder communicator = initialize(argc, argv, properties);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+    ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->activate();
+
+    {
+        cout << "testing host lookup... " << flush;
+        LookupIPtr lookup = new LookupI(getTestHost());
+        CommunicatorHolder ich(createCommunicator(properties, 1, 0, lookup));
+
+        test(createProxy(ich.communicator(), "stub.host", "c1")->ice_getConnection());
+        test(lookup->lookups("stub.host") == 1);
+
+        //
+        // Without cache, each connection establishment looks up the host.
+        //
+        test(createProxy(ich.communicator(), "stub.host", "c2")->ice_getConnection());
+        test(lookup->lookups("stub.host") == 2);
+
+        try
+        {
+            createProxy(ich.communicator(), "unknown.host", "c1")->ice_getConnection();
+            test(false);
+        }
+        catch(const Ice::DNSException& ex)
+        {
+            test(ex.host == "unknown.host");
+        }
+        test(lookup->lookups("unknown.host") == 1);
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "testing concurrent lookups... " << flush;
+        LookupIPtr lookup = new LookupI(getTestHost());
+        CommunicatorHolder ich(createCommunicator(properties, 2, 0, lookup));
+
+        lookup->hold("stub.host");
+        vector<ConnectThreadPtr> threads;
+        for(int i = 0; i < 5; ++i)
+        {
+            ostringstream os;
+            os << "c" << i;
+            ConnectThreadPtr thread = new ConnectThread(createProxy(ich.communicator(), "stub.host", os.str()));
+            thread->start();
+            threads.push_back(thread);
+        }
+        lookup->waitForLookup("stub.host");
+
+        //
+        // The second thread resolves other hosts while the first one is
+        // blocked on stub.host.
+        //
+        try
+        {
+            createProxy(ich.communicator(), "unknown.host", "c1")->ice_getConnection();
+            test(false);
+        }
+        catch(const Ice::DNSException&)
+        {
+        }
+
+        //
+        // Give the connection establishments time to reach the resolver, they
+        // must all wait for the lookup in progress.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        test(lookup->lookups("stub.host") == 1);
+        lookup->release("stub.host");
+
+        for(vector<ConnectThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+        {
+            (*p)->getThreadControl().join();
+            test((*p)->connected());
+        }
+        test(lookup->lookups("stub.host") == 1);
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "testing lookup cache... " << flush;
+        LookupIPtr lookup = new LookupI(getTestHost());
+        CommunicatorHolder ich(createCommunicator(properties, 1, 1, lookup));
+
+        test(createProxy(ich.communicator(), "stub.host", "c1")->ice_getConnection());
+        test(createProxy(ich.communicator(), "stub.host", "c2")->ice_getConnection());
+        test(createProxy(ich.communicator(), "stub.host", "c3")->ice_endpointSelection(
+                 ICE_ENUM(EndpointSelectionType, Random))->ice_getConnection());
+        test(lookup->lookups("stub.host") == 1);
+
+        //
+        // Failed lookups are not cached.
+        //
+        for(int i = 0; i < 2; ++i)
+        {
+            try
+            {
+                createProxy(ich.communicator(), "unknown.host", "c1")->ice_getConnection();
+                test(false);
+            }
+            catch(const Ice::DNSException&)
+            {
+            }
+        }
+        test(lookup->lookups("unknown.host") == 2);
+
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1100));
+        test(createProxy(ich.communicator(), "stub.host", "c4")->ice_getConnection());
+        test(lookup->lookups("stub.host") == 2);
+        cout << "ok" << endl;
+    }
+}
+
+DEFINE_TEST(Client)
@@ -627,6 +627,47 @@ allTests(Test::TestHelper* helper, const string& ref)
     }
     cout << "ok" << endl;
 
+    cout << "testing locator cache refresh-ahead... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheRefreshAhead", "50");
+        initData.properties->setProperty("Ice.LocatorCacheJitter", "10");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        registry->setAdapterDirectProxy("TestAdapter5", locator->findAdapterById("TestAdapter"));
+
+        count = locator->getRequestCount();
+        ic->stringToProxy("test@TestAdapter5")->ice_locatorCacheTimeout(2)->ice_ping();
+        test(++count == locator->getRequestCount());
+        ic->stringToProxy("test@TestAdapter5")->ice_locatorCacheTimeout(2)->ice_ping(); // Cached.
+        test(count == locator->getRequestCount());
+
+        //
+        // The entry is valid for at least 1.8s (2s minus 10% jitter) and is refreshed in the
+        // background once it's in the second half of its lifetime. The request still uses the
+        // cached endpoints.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1200));
+        ic->stringToProxy("test@TestAdapter5")->ice_locatorCacheTimeout(2)->ice_ping();
+        int nRetry = 0;
+        while(locator->getRequestCount() == count && nRetry++ < 100)
+        {
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(++count == locator->getRequestCount());
+
+        //
+        // The refreshed entry is valid again.
+        //
+        ic->stringToProxy("test@TestAdapter5")->ice_locatorCacheTimeout(2)->ice_ping();
+        test(count == locator->getRequestCount());
+
+        registry->setAdapterDirectProxy("TestAdapter5", 0);
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxy from server after shutdown... " << flush;
     hello = obj->getReplicatedHello();
     obj->shutdown();
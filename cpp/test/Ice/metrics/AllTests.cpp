@@ -557,6 +557,46 @@ toMap(const IceMX::MetricsMap& mmap)
     return m;
 }
 
+class InvokeThread : public IceUtil::Thread
+{
+public:
+
+    InvokeThread(const MetricsPrxPtr& proxy, int count) : _proxy(proxy), _count(count)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        for(int i = 0; i < _count; ++i)
+        {
+            _proxy->ice_ping();
+            _proxy->ice_id();
+            test(_proxy->ice_isA("::Test::Metrics"));
+        }
+    }
+
+private:
+
+    const MetricsPrxPtr _proxy;
+    const int _count;
+};
+
+void
+invokeFromThreads(const MetricsPrxPtr& proxy, int threads, int count)
+{
+    vector<IceUtil::ThreadControl> controls;
+    for(int i = 0; i < threads; ++i)
+    {
+        IceUtil::ThreadPtr thread = new InvokeThread(proxy, count);
+        controls.push_back(thread->start());
+    }
+    for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+    {
+        p->join();
+    }
+}
+
 }
 
 MetricsPrxPtr
@@ -693,6 +733,70 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
 
     cout << "ok" << endl;
 
+    cout << "testing lifetime histogram..." << flush;
+
+    props["IceMX.Metrics.View.GroupBy"] = "none";
+    props["IceMX.Metrics.View.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update.get(), props);
+
+    for(int i = 0; i < 10; ++i)
+    {
+        metrics->op();
+    }
+
+    waitForCurrent(clientMetrics, "View", "Invocation", 0);
+    waitForCurrent(serverMetrics, "View", "Dispatch", 0);
+
+    IceMX::MetricsHistograms histograms = clientMetrics->getMetricsHistograms("View", "Invocation");
+    test(histograms.size() == 1);
+    Ice::LongSeq histogram = histograms.begin()->second;
+    test(!histogram.empty() && histogram.back() > 0);
+    test(histogram.size() <= 304);
+    Ice::Long count = 0;
+    for(Ice::LongSeq::const_iterator p = histogram.begin(); p != histogram.end(); ++p)
+    {
+        count += *p;
+    }
+    test(count == 10);
+
+    histograms = serverMetrics->getMetricsHistograms("View", "Dispatch");
+    test(histograms.size() == 1);
+    count = 0;
+    for(Ice::LongSeq::const_iterator p = histograms.begin()->second.begin(); p != histograms.begin()->second.end();
+        ++p)
+    {
+        count += *p;
+    }
+    test(count == 10);
+
+    try
+    {
+        clientMetrics->getMetricsHistograms("Unknown", "Invocation");
+        test(false);
+    }
+    catch(const IceMX::UnknownMetricsView&)
+    {
+    }
+
+    props.erase("IceMX.Metrics.View.Histogram");
+    updateProps(clientProps, serverProps, update.get(), props);
+
+    metrics->op();
+    waitForCurrent(clientMetrics, "View", "Invocation", 0);
+    test(clientMetrics->getMetricsHistograms("View", "Invocation").empty());
+
+    if(!collocated)
+    {
+        metrics->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+
+        waitForCurrent(clientMetrics, "View", "Connection", 0);
+        waitForCurrent(serverMetrics, "View", "Connection", 0);
+    }
+
+    clearView(clientProps, serverProps, update.get());
+
+    cout << "ok" << endl;
+
     map<string, IceMX::MetricsPtr> map;
 
     string type;
@@ -1669,6 +1773,40 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
     }
     cout << "ok" << endl;
 
+    cout << "testing accept and reject filters..." << flush;
+    {
+        //
+        // The results of the filters are memoized by each thread, invoke from
+        // several threads and check that updating the filters discards the
+        // results of the previous filters for the same operations.
+        //
+        const int threads = 4;
+        const int invocations = 20;
+
+        Ice::PropertyDict filterProps;
+        filterProps["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "operation";
+        filterProps["IceMX.Metrics.View.Map.Invocation.Accept.operation"] = "ice_ping|ice_id";
+        updateProps(clientProps, serverProps, update.get(), filterProps, "Invocation");
+
+        invokeFromThreads(metrics, threads, invocations);
+        waitForCurrent(clientMetrics, "View", "Invocation", 0);
+        map = toMap(clientMetrics->getMetricsView("View", timestamp)["Invocation"]);
+        test(map.size() == 2);
+        test(map["ice_ping"]->total == threads * invocations);
+        test(map["ice_id"]->total == threads * invocations);
+
+        filterProps.erase("IceMX.Metrics.View.Map.Invocation.Accept.operation");
+        filterProps["IceMX.Metrics.View.Map.Invocation.Reject.operation"] = "ice_ping|ice_id";
+        updateProps(clientProps, serverProps, update.get(), filterProps, "Invocation");
+
+        invokeFromThreads(metrics, threads, invocations);
+        waitForCurrent(clientMetrics, "View", "Invocation", 0);
+        map = toMap(clientMetrics->getMetricsView("View", timestamp)["Invocation"]);
+        test(map.size() == 1);
+        test(map["ice_isA"]->total == threads * invocations);
+    }
+    cout << "ok" << endl;
+
     cout << "testing metrics view enable/disable..." << flush;
 
     Ice::StringSeq disabledViews;
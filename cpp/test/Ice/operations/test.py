@@ -0,0 +1,13 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+TestSuite(__file__, [
+    ClientServerTestCase(),
+    ClientAMDServerTestCase(),
+    CollocatedTestCase(),
+    CollocatedTestCase(name="collocated with direct dispatch", props={ "Ice.CollocationDirectDispatch" : 1 }),
+    ClientServerTestCase(name="client/server with small buffer pool",
+                         props={ "Ice.BufferPool.MaxSize" : 512, "Ice.BufferPool.MaxBuffers" : 1 }),
+    ClientServerTestCase(name="client/server without buffer pool", props={ "Ice.BufferPool.MaxSize" : 0 })
+])
@@ -785,6 +785,76 @@ allTests(Test::TestHelper* helper)
 #endif
     }
 
+    {
+        test(Ice::IsPacked<PackedStruct>::value);
+        test(!Ice::IsPacked<PaddedStruct>::value);
+        test(!Ice::IsPacked<SmallStruct>::value);
+
+        PackedStructS arr;
+        for(int i = 0; i < 4; ++i)
+        {
+            PackedStruct s;
+            s.i = i;
+            s.sh1 = static_cast<Ice::Short>(i + 1);
+            s.sh2 = static_cast<Ice::Short>(i + 2);
+            s.d = i + 0.5;
+            arr.push_back(s);
+        }
+        Ice::OutputStream out(communicator);
+        out.write(arr);
+        out.write(&arr[0], &arr[0] + arr.size());
+        out.write(PackedStructS());
+        out.finished(data);
+        test(data.size() == 2 * (1 + 4 * 16) + 1);
+
+        Ice::InputStream in(communicator, data);
+        PackedStructS arr2;
+        in.read(arr2);
+        test(arr2.size() == arr.size());
+        for(PackedStructS::size_type j = 0; j < arr2.size(); ++j)
+        {
+            test(arr2[j].i == arr[j].i && arr2[j].sh1 == arr[j].sh1 && arr2[j].sh2 == arr[j].sh2 &&
+                 arr2[j].d == arr[j].d);
+        }
+#ifdef ICE_CPP11_MAPPING
+        pair<const PackedStruct*, const PackedStruct*> p;
+        in.read(p);
+        test(p.second - p.first == 4);
+        for(int j = 0; j < 4; ++j)
+        {
+            test(p.first[j].i == j && p.first[j].sh1 == j + 1 && p.first[j].sh2 == j + 2 && p.first[j].d == j + 0.5);
+        }
+#else
+        arr2.clear();
+        in.read(arr2);
+        test(arr2.size() == arr.size());
+#endif
+        in.read(arr2);
+        test(arr2.empty());
+
+        PaddedStructS arr3;
+        for(int i = 0; i < 4; ++i)
+        {
+            PaddedStruct s;
+            s.by = static_cast<Ice::Byte>(i);
+            s.i = i + 1;
+            arr3.push_back(s);
+        }
+        Ice::OutputStream out2(communicator);
+        out2.write(arr3);
+        out2.finished(data);
+        test(data.size() == 1 + 4 * 5);
+
+        Ice::InputStream in2(communicator, data);
+        PaddedStructS arr4;
+        in2.read(arr4);
+        test(arr4.size() == arr3.size());
+        for(PaddedStructS::size_type j = 0; j < arr4.size(); ++j)
+        {
+            test(arr4[j].by == arr3[j].by && arr4[j].i == arr3[j].i);
+        }
+    }
+
     {
         MyClassS arr;
         for(int i = 0; i < 4; ++i)
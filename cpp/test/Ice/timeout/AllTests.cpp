@@ -470,6 +470,29 @@ allTestsWithController(Test::TestHelper* helper, const ControllerPrxPtr& control
     }
     cout << "ok" << endl;
 
+    cout << "testing connection racing... " << flush;
+    {
+        //
+        // The first endpoint doesn't validate connections while the adapter
+        // is held, the connection to the second endpoint wins the race.
+        //
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectRace.Connectors", "2");
+        initData.properties->setProperty("Ice.ConnectRace.Delay", "50");
+        Ice::CommunicatorHolder ich(initData);
+        Ice::ObjectPrxPtr proxy = ich->stringToProxy("controller:" + helper->getTestEndpoint() + " -t 10000:" +
+                                                     helper->getTestEndpoint(1));
+        proxy = proxy->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered));
+        controller->holdAdapter(-1);
+        IceUtil::Time now = IceUtil::Time::now();
+        proxy->ice_ping();
+        test(IceUtil::Time::now() - now < IceUtil::Time::milliSeconds(2000));
+        controller->resumeAdapter();
+        timeout->op(); // Ensure adapter is active.
+    }
+    cout << "ok" << endl;
+
     cout << "testing invocation timeouts with collocated calls... " << flush;
     {
         communicator->getProperties()->setProperty("TimeoutCollocated.AdapterId", "timeoutAdapter");
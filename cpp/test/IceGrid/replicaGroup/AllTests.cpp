@@ -485,6 +485,55 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing replication with latency load balancing... " << flush;
+    {
+        map<string, string> params;
+        params["replicaGroup"] = "Latency";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server2";
+        params["delay"] = "100";
+        instantiateServer(admin, "Server", "localnode", params);
+        TestIntfPrx server1 = TestIntfPrx::uncheckedCast(comm->stringToProxy("Server1"));
+        TestIntfPrx server2 = TestIntfPrx::uncheckedCast(comm->stringToProxy("Server2"));
+        TestIntfPrx obj = TestIntfPrx::uncheckedCast(comm->stringToProxy("Latency"));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_locatorCacheTimeout(0));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_connectionCached(false));
+
+        //
+        // Dispatch requests on both replicas until the node reports
+        // their load, the slow replica should no longer be selected.
+        //
+        int retry = 0;
+        while(true)
+        {
+            try
+            {
+                server1->getReplicaId();
+                server2->getReplicaId();
+                int i = 0;
+                while(i < 20 && obj->getReplicaId() == "Server1.ReplicatedAdapter")
+                {
+                    ++i;
+                }
+                if(i == 20)
+                {
+                    break;
+                }
+            }
+            catch(const Ice::LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+            test(++retry < 200);
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        }
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+    }
+    cout << "ok" << endl;
+
     cout << "testing filters... " << flush;
     {
         map<string, string> params;
@@ -23,9 +23,14 @@ clientTraceProps = {
     "Ice.Trace.Protocol": 1
 }
 
+nodeProps = {
+    "IceGrid.Node.AdapterLoadPeriod" : 1
+}
+
 if isinstance(platform, Windows) or os.getuid() != 0:
     TestSuite(__file__,
               [IceGridTestCase(icegridregistry=[IceGridRegistryMaster(props=registryProps, traceProps=registryTraceProps)],
+                               icegridnode=IceGridNode(props=nodeProps),
                                client=IceGridClient(props=clientProps, traceProps=clientTraceProps))],
               libDirs=["registryplugin", "testservice"],
               multihost=False)
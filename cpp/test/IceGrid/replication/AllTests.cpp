@@ -1478,4 +1478,101 @@ allTests(Test::TestHelper* helper)
     removeServer(admin, "Slave1");
     masterAdmin->shutdown();
     removeServer(admin, "Master");
+
+    cout << "testing incremental synchronization of replicas... " << flush;
+    {
+        params.clear();
+        params["id"] = "IncrementalMaster";
+        params["replicaName"] = "";
+        params["port"] = "12050";
+        instantiateServer(admin, "IceGridRegistry", params);
+
+        params.clear();
+        params["id"] = "IncrementalSlave";
+        params["replicaName"] = "Slave1";
+        params["port"] = "12051";
+        instantiateServer(admin, "IceGridRegistry", params);
+
+        admin->startServer("IncrementalMaster");
+        masterAdmin = createAdminSession(masterLocator, "");
+        admin->startServer("IncrementalSlave");
+        slave1Admin = createAdminSession(slave1Locator, "Slave1");
+
+        ApplicationDescriptor app;
+        app.description = "added application";
+        app.name = "App1";
+        masterAdmin->addApplication(app);
+        test(slave1Admin->getApplicationInfo("App1").descriptor.description == app.description);
+
+        //
+        // The slave only gets the changes since its serials when it
+        // reconnects to the master.
+        //
+        slave1Admin->shutdown();
+        waitForServerState(admin, "IncrementalSlave", false);
+
+        app.name = "App2";
+        masterAdmin->addApplication(app);
+        masterAdmin->removeApplication("App1");
+
+        admin->startServer("IncrementalSlave");
+        slave1Admin = createAdminSession(slave1Locator, "Slave1");
+        test(slave1Admin->getApplicationInfo("App2").descriptor.description == app.description);
+        try
+        {
+            slave1Admin->getApplicationInfo("App1");
+            test(false);
+        }
+        catch(const ApplicationNotExistException&)
+        {
+        }
+
+        //
+        // Start a master with a new database and update it until its
+        // serials are the same as the slave serials. The slave database
+        // is from another epoch and it must get a full synchronization.
+        //
+        slave1Admin->shutdown();
+        waitForServerState(admin, "IncrementalSlave", false);
+        masterAdmin->shutdown();
+        waitForServerState(admin, "IncrementalMaster", false);
+
+        params.clear();
+        params["id"] = "IncrementalMaster2";
+        params["replicaName"] = "";
+        params["port"] = "12050";
+        instantiateServer(admin, "IceGridRegistry", params);
+
+        admin->startServer("IncrementalMaster2");
+        masterAdmin = createAdminSession(masterLocator, "");
+
+        const char* names[] = { "App3", "App4", "App5" };
+        for(size_t i = 0; i < sizeof(names) / sizeof(const char*); ++i)
+        {
+            app.name = names[i];
+            masterAdmin->addApplication(app);
+        }
+
+        admin->startServer("IncrementalSlave");
+        slave1Admin = createAdminSession(slave1Locator, "Slave1");
+        for(size_t i = 0; i < sizeof(names) / sizeof(const char*); ++i)
+        {
+            test(slave1Admin->getApplicationInfo(names[i]).descriptor.description == app.description);
+        }
+        try
+        {
+            slave1Admin->getApplicationInfo("App2");
+            test(false);
+        }
+        catch(const ApplicationNotExistException&)
+        {
+        }
+
+        slave1Admin->shutdown();
+        removeServer(admin, "IncrementalSlave");
+        masterAdmin->shutdown();
+        removeServer(admin, "IncrementalMaster2");
+        removeServer(admin, "IncrementalMaster");
+    }
+    cout << "ok" << endl;
 }
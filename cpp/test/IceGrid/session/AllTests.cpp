@@ -470,6 +470,34 @@ public:
 };
 typedef IceUtil::Handle<RegistryObserverI> RegistryObserverIPtr;
 
+class RemoveThread : public IceUtil::Thread
+{
+public:
+
+    RemoveThread(const AdminPrx& admin, const Ice::LocatorRegistryPrx& locatorRegistry, int count) :
+        _admin(admin), _locatorRegistry(locatorRegistry), _count(count)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        for(int i = _count - 1; i >= 0; --i)
+        {
+            ostringstream os;
+            os << "paged" << i;
+            _admin->removeObject(Ice::stringToIdentity(os.str()));
+            _locatorRegistry->setAdapterDirectProxy(os.str(), 0);
+        }
+    }
+
+private:
+
+    const AdminPrx _admin;
+    const Ice::LocatorRegistryPrx _locatorRegistry;
+    const int _count;
+};
+
 void
 testFailedAndPrintObservers(const char* expr, const char* file, unsigned int line)
 {
@@ -1670,6 +1698,103 @@ allTests(Test::TestHelper* helper)
         cout << "ok" << endl;
     }
 
+    {
+        cout << "testing paged observer initialization... " << flush;
+
+        //
+        // The registry sends the initial state of the adapter and object
+        // observers in pages of IceGrid.Registry.ObserverInitPageSize
+        // entries, see test.py.
+        //
+        const int count = 50;
+        Ice::LocatorRegistryPrx locatorRegistry = communicator->getDefaultLocator()->getRegistry();
+        for(int i = 0; i < count; ++i)
+        {
+            ostringstream os;
+            os << "paged" << i;
+            admin->addObjectWithType(communicator->stringToProxy(os.str() + ":tcp -p 10000"), "::Paged");
+            locatorRegistry->setAdapterDirectProxy(os.str(), communicator->stringToProxy("dummy:tcp -p 10000"));
+        }
+
+        for(int removed = 0; removed < 2; ++removed)
+        {
+            AdminSessionPrx session1 = AdminSessionPrx::uncheckedCast(registry->createAdminSession("admin1", "test1"));
+            session1->ice_getConnection()->setACM(registry->getACMTimeout(), IceUtil::None, Ice::HeartbeatOnIdle);
+
+            Ice::ObjectAdapterPtr adpt1 = communicator->createObjectAdapter("");
+            AdapterObserverIPtr adptObs1 = new AdapterObserverI("adptObs1");
+            ObjectObserverIPtr objectObs1 = new ObjectObserverI("objectObs1");
+            Ice::ObjectPrx adapter1 = adpt1->addWithUUID(adptObs1);
+            Ice::ObjectPrx object1 = adpt1->addWithUUID(objectObs1);
+            adpt1->activate();
+            registry->ice_getConnection()->setAdapter(adpt1);
+
+            //
+            // The second time, remove the entries while the observers are
+            // initialized, the observers must get the removal updates after
+            // the entries.
+            //
+            IceUtil::ThreadControl control;
+            if(removed)
+            {
+                IceUtil::ThreadPtr thread = new RemoveThread(admin, locatorRegistry, count);
+                control = thread->start();
+            }
+            session1->setObserversByIdentity(Ice::Identity(),
+                                             Ice::Identity(),
+                                             Ice::Identity(),
+                                             adapter1->ice_getIdentity(),
+                                             object1->ice_getIdentity());
+            if(removed)
+            {
+                control.join();
+            }
+
+            //
+            // The observers get the updates published after setObservers
+            // returned after their whole initial state.
+            //
+            Ice::ObjectPrx obj = communicator->stringToProxy("pagedEnd:tcp -p 10000");
+            admin->addObjectWithType(obj, "::Paged");
+            locatorRegistry->setAdapterDirectProxy("pagedEnd", obj);
+            while(true)
+            {
+                objectObs1->waitForUpdate(__FILE__, __LINE__);
+                IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*objectObs1);
+                if(objectObs1->objects.find(Ice::stringToIdentity("pagedEnd")) != objectObs1->objects.end())
+                {
+                    break;
+                }
+            }
+            while(true)
+            {
+                adptObs1->waitForUpdate(__FILE__, __LINE__);
+                IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*adptObs1);
+                if(adptObs1->adapters.find("pagedEnd") != adptObs1->adapters.end())
+                {
+                    break;
+                }
+            }
+
+            for(int i = 0; i < count; ++i)
+            {
+                ostringstream os;
+                os << "paged" << i;
+                test((objectObs1->objects.find(Ice::stringToIdentity(os.str())) == objectObs1->objects.end()) ==
+                     (removed == 1));
+                test((adptObs1->adapters.find(os.str()) == adptObs1->adapters.end()) == (removed == 1));
+            }
+
+            admin->removeObject(obj->ice_getIdentity());
+            locatorRegistry->setAdapterDirectProxy("pagedEnd", 0);
+
+            session1->destroy();
+            adpt1->destroy();
+        }
+
+        cout << "ok" << endl;
+    }
+
     {
 //      cout << "???" << endl;
 
@@ -30,6 +30,7 @@ registryProps = {
     'IceGrid.Registry.AdminPermissionsVerifier' : 'AdminPermissionsVerifier:tcp -p 12002',
     'IceGrid.Registry.SSLPermissionsVerifier' : 'SSLPermissionsVerifier',
     'IceGrid.Registry.AdminSSLPermissionsVerifier' : 'SSLPermissionsVerifier',
+    'IceGrid.Registry.ObserverInitPageSize' : 10,
 }
 
 clientProps = lambda process, current: {
@@ -2416,6 +2416,68 @@ allTests(Test::TestHelper* helper, const string& /*testDir*/, bool p12)
     cout << "ok" << endl;
 
 #ifdef ICE_USE_OPENSSL
+    cout << "testing session resumption... " << flush;
+    {
+        InitializationData initData;
+        initData.properties = createClientProps(defaultProps, p12, "c_rsa_ca1", "cacert1");
+        initData.properties->setProperty("IceSSL.SessionCache.Size", "10");
+        CommunicatorPtr comm = initialize(initData);
+        Test::ServerFactoryPrxPtr fact = ICE_CHECKED_CAST(Test::ServerFactoryPrx, comm->stringToProxy(factoryRef));
+        test(fact);
+        Test::Properties d = createServerProps(defaultProps, p12, "s_rsa_ca1", "cacert1");
+        d["IceSSL.SessionCache.Size"] = "10";
+        Test::ServerPrxPtr server = fact->createServer(d);
+
+        info = ICE_DYNAMIC_CAST(IceSSL::ConnectionInfo, server->ice_getConnection()->getInfo());
+        test(!info->resumed && info->verified && info->certs.size() == 2);
+        IceSSL::CertificatePtr serverCert = info->certs[0];
+        server->ice_getConnection()->close(ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        server->ice_ping(); // Establish a new connection.
+
+        //
+        // The new connection resumes the session, the client and server still
+        // get the verified certificate chain of their peer.
+        //
+        info = ICE_DYNAMIC_CAST(IceSSL::ConnectionInfo, server->ice_getConnection()->getInfo());
+        test(info->resumed && info->verified && info->certs.size() == 2);
+        test(info->certs[0]->getSubjectDN() == serverCert->getSubjectDN());
+#  if defined(_WIN32)
+        IceSSL::CertificatePtr clientCert = IceSSL::OpenSSL::Certificate::load(defaultDir + "/c_rsa_ca1_pub.pem");
+#  else
+        IceSSL::CertificatePtr clientCert = IceSSL::Certificate::load(defaultDir + "/c_rsa_ca1_pub.pem");
+#  endif
+        server->checkCert(clientCert->getSubjectDN(), clientCert->getIssuerDN());
+        server->ice_getConnection()->close(ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        server->ice_ping();
+
+        //
+        // With TLS 1.3 a ticket is only used once, the session is resumed again
+        // with the ticket received over the previous resumed connection.
+        //
+        info = ICE_DYNAMIC_CAST(IceSSL::ConnectionInfo, server->ice_getConnection()->getInfo());
+        test(info->resumed && info->verified);
+        server->ice_getConnection()->close(ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        comm->destroy();
+
+        //
+        // Sessions aren't resumed without the client session cache.
+        //
+        initData.properties = createClientProps(defaultProps, p12, "c_rsa_ca1", "cacert1");
+        comm = initialize(initData);
+        fact = ICE_CHECKED_CAST(Test::ServerFactoryPrx, comm->stringToProxy(factoryRef));
+        server = ICE_UNCHECKED_CAST(Test::ServerPrx, comm->stringToProxy(server->ice_toString()));
+        for(int i = 0; i < 2; ++i)
+        {
+            info = ICE_DYNAMIC_CAST(IceSSL::ConnectionInfo, server->ice_getConnection()->getInfo());
+            test(!info->resumed);
+            server->ice_getConnection()->close(ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+            server->ice_ping();
+        }
+        fact->destroyServer(server);
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing CA certificate directory... " << flush;
     {
         //
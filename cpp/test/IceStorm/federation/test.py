@@ -27,6 +27,8 @@ props = {'IceStorm.ReplicatedPublishEndpoints' : ''}
 TestSuite(__file__, [
     IceStormFederationTestCase("persistent", icestorm=IceStorm()),
     IceStormFederationTestCase("transient", icestorm=IceStorm(transient=True)),
+    IceStormFederationTestCase("persistent with bounded forward batches",
+                               icestorm=IceStorm(props={'IceStorm.Send.BatchSizeMax' : 2})),
     IceStormFederationTestCase("replicated with non-replicated publisher",
                                icestorm=[IceStorm(replica=i, nreplicas=3, props=props) for i in range(0,3)]),
     IceStormFederationTestCase("replicated with replicated publisher",
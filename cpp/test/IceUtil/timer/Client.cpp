@@ -2,6 +2,7 @@
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
 
+#include <Ice/Ice.h>
 #include <IceUtil/Timer.h>
 #include <IceUtil/Random.h>
 #include <TestHelper.h>
@@ -153,14 +154,84 @@ public:
 
     void run(int argc, char* argv[]);
 
+private:
+
+    void allTests(const IceUtil::Time&);
+    IceUtil::TimerPtr createTimer(const IceUtil::Time&);
+
+    vector<Ice::CommunicatorPtr> _communicators;
 };
 
 void
 Client::run(int, char*[])
 {
-    cout << "testing timer... " << flush;
+    allTests(IceUtil::Time());
+
+    cout << "testing timer with timing wheel... " << flush;
+    {
+        IceUtil::TimerPtr timer = createTimer(IceUtil::Time::milliSeconds(1));
+
+        //
+        // Tasks beyond the first level of the wheel, they are moved to the
+        // lower levels as the timer thread gets closer to their execution.
+        //
+        vector<TestTaskPtr> tasks;
+        for(int i = 0; i < 10; ++i)
+        {
+            tasks.push_back(ICE_MAKE_SHARED(TestTask, IceUtil::Time::milliSeconds(300 + i * 20)));
+        }
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(vector<TestTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            timer->schedule(*p, (*p)->getScheduledTime());
+        }
+        test(timer->cancel(tasks.back()));
+        tasks.pop_back();
+        for(vector<TestTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            (*p)->waitForRun();
+            test((*p)->getRunTime() - start >= (*p)->getScheduledTime());
+        }
+        timer->destroy();
+    }
+    cout << "ok" << endl;
+
+    allTests(IceUtil::Time::milliSeconds(1));
+
+    for(vector<Ice::CommunicatorPtr>::const_iterator p = _communicators.begin(); p != _communicators.end(); ++p)
+    {
+        (*p)->destroy();
+    }
+}
+
+//
+// The communicator timer keeps the tasks of the Ice runtime in a timing
+// wheel with Ice.TimerTick, its thread also executes the tasks scheduled
+// with the IceUtil::Timer methods.
+//
+IceUtil::TimerPtr
+Client::createTimer(const IceUtil::Time& tick)
+{
+    if(tick == IceUtil::Time())
+    {
+        return new IceUtil::Timer();
+    }
+
+    Ice::InitializationData initData;
+    initData.properties = Ice::createProperties();
+    ostringstream os;
+    os << tick.toMilliSeconds();
+    initData.properties->setProperty("Ice.TimerTick", os.str());
+    _communicators.push_back(Ice::initialize(initData));
+    return IceInternal::getInstanceTimer(_communicators.back());
+}
+
+void
+Client::allTests(const IceUtil::Time& tick)
+{
+    cout << "testing timer" << (tick == IceUtil::Time() ? "" : " (timing wheel)") << "... " << flush;
     {
-        IceUtil::TimerPtr timer = new IceUtil::Timer();
+        IceUtil::TimerPtr timer = createTimer(tick);
 
         {
             TestTaskPtr task = ICE_MAKE_SHARED(TestTask);
@@ -247,10 +318,10 @@ Client::run(int, char*[])
     }
     cout << "ok" << endl;
 
-    cout << "testing timer destroy... " << flush;
+    cout << "testing timer destroy" << (tick == IceUtil::Time() ? "" : " (timing wheel)") << "... " << flush;
     {
         {
-            IceUtil::TimerPtr timer = new IceUtil::Timer();
+            IceUtil::TimerPtr timer = createTimer(tick);
             DestroyTaskPtr destroyTask = ICE_MAKE_SHARED(DestroyTask, timer);
             timer->schedule(destroyTask, IceUtil::Time());
             destroyTask->waitForRun();
@@ -264,7 +335,7 @@ Client::run(int, char*[])
             }
         }
         {
-            IceUtil::TimerPtr timer = new IceUtil::Timer();
+            IceUtil::TimerPtr timer = createTimer(tick);
             TestTaskPtr testTask = ICE_MAKE_SHARED(TestTask);
             timer->schedule(testTask, IceUtil::Time());
             timer->destroy();
@@ -890,6 +890,18 @@ namespace IceInternal
             }
         }
 
+        override public Dictionary<string, long[]> getMetricsHistograms(string viewName, string mapName, Ice.Current c)
+        {
+            //
+            // Lifetime histograms are only supported by the C++ metrics maps.
+            //
+            lock(this)
+            {
+                getMetricsView(viewName);
+                return new Dictionary<string, long[]>();
+            }
+        }
+
         public void registerMap<T>(string map, Action updater)
             where T : IceMX.Metrics, new()
         {
@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Thu Jul  2 14:55:02 2020
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 07:26:12 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -30,6 +30,7 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ACM\.Heartbeat$", false, null),
              new Property(@"^Ice\.Admin\.ACM\.Close$", false, null),
              new Property(@"^Ice\.Admin\.ACM$", false, null),
+             new Property(@"^Ice\.Admin\.Acceptors$", false, null),
              new Property(@"^Ice\.Admin\.AdapterId$", false, null),
              new Property(@"^Ice\.Admin\.Endpoints$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.EndpointSelection$", false, null),
@@ -55,13 +56,17 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^Ice\.Admin\.Router$", false, null),
              new Property(@"^Ice\.Admin\.ProxyOptions$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Backend$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.Size$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.StackSize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^Ice\.Admin\.MessageSizeMax$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Enabled$", false, null),
@@ -74,11 +79,18 @@ namespace IceInternal
              new Property(@"^Ice\.BackgroundLocatorCacheUpdates$", false, null),
              new Property(@"^Ice\.BatchAutoFlush$", true, null),
              new Property(@"^Ice\.BatchAutoFlushSize$", false, null),
+             new Property(@"^Ice\.BufferPool\.MaxBuffers$", false, null),
+             new Property(@"^Ice\.BufferPool\.MaxSize$", false, null),
              new Property(@"^Ice\.ChangeUser$", false, null),
              new Property(@"^Ice\.ClassGraphDepthMax$", false, null),
              new Property(@"^Ice\.ClientAccessPolicyProtocol$", false, null),
+             new Property(@"^Ice\.Compression\.Compressor$", false, null),
              new Property(@"^Ice\.Compression\.Level$", false, null),
+             new Property(@"^Ice\.Compression\.Threshold$", false, null),
              new Property(@"^Ice\.CollectObjects$", false, null),
+             new Property(@"^Ice\.CollocationDirectDispatch$", false, null),
+             new Property(@"^Ice\.ConnectRace\.Connectors$", false, null),
+             new Property(@"^Ice\.ConnectRace\.Delay$", false, null),
              new Property(@"^Ice\.Config$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
@@ -117,10 +129,14 @@ namespace IceInternal
              new Property(@"^Ice\.FactoryAssemblies$", false, null),
              new Property(@"^Ice\.HTTPProxyHost$", false, null),
              new Property(@"^Ice\.HTTPProxyPort$", false, null),
+             new Property(@"^Ice\.HostResolver\.CacheTimeout$", false, null),
+             new Property(@"^Ice\.HostResolver\.Threads$", false, null),
              new Property(@"^Ice\.ImplicitContext$", false, null),
              new Property(@"^Ice\.InitPlugins$", false, null),
              new Property(@"^Ice\.IPv4$", false, null),
              new Property(@"^Ice\.IPv6$", false, null),
+             new Property(@"^Ice\.LocatorCacheJitter$", false, null),
+             new Property(@"^Ice\.LocatorCacheRefreshAhead$", false, null),
              new Property(@"^Ice\.LogFile$", false, null),
              new Property(@"^Ice\.LogFile\.SizeMax$", false, null),
              new Property(@"^Ice\.LogStdErr\.Convert$", false, null),
@@ -148,24 +164,34 @@ namespace IceInternal
              new Property(@"^Ice\.StdErr$", false, null),
              new Property(@"^Ice\.StdOut$", false, null),
              new Property(@"^Ice\.SyslogFacility$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Affinity$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Backend$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.SizeWarn$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.NumaNode$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.StackSize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.WorkStealing$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Affinity$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Backend$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeWarn$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.NumaNode$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.StackSize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.WorkStealing$", false, null),
              new Property(@"^Ice\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.TimerTick$", false, null),
              new Property(@"^Ice\.ToStringMode$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Properties$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Logger$", false, null),
+             new Property(@"^Ice\.Trace\.BufferPool$", false, null),
              new Property(@"^Ice\.Trace\.Locator$", false, null),
              new Property(@"^Ice\.Trace\.Network$", false, null),
              new Property(@"^Ice\.Trace\.Protocol$", false, null),
@@ -201,6 +227,7 @@ namespace IceInternal
              new Property(@"^IceMX\.Metrics\.[^\s]+\.RetainDetached$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+\.Accept$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+\.Reject$", false, null),
+             new Property(@"^IceMX\.Metrics\.[^\s]+\.Histogram$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+$", false, null),
              null
         };
@@ -211,6 +238,7 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ACM$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Acceptors$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.AdapterId$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.EndpointSelection$", false, null),
@@ -236,18 +264,23 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ProxyOptions$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Size$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Acceptors$", false, null),
              new Property(@"^IceDiscovery\.Reply\.AdapterId$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.EndpointSelection$", false, null),
@@ -273,18 +306,23 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ProxyOptions$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Size$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceDiscovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Acceptors$", false, null),
              new Property(@"^IceDiscovery\.Locator\.AdapterId$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.EndpointSelection$", false, null),
@@ -310,13 +348,17 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ProxyOptions$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Size$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceDiscovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Lookup$", false, null),
              new Property(@"^IceDiscovery\.Timeout$", false, null),
@@ -335,6 +377,7 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Acceptors$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.AdapterId$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.EndpointSelection$", false, null),
@@ -360,18 +403,23 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ProxyOptions$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Size$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Acceptors$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.AdapterId$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.EndpointSelection$", false, null),
@@ -397,13 +445,17 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ProxyOptions$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Size$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Lookup$", false, null),
              new Property(@"^IceLocatorDiscovery\.Timeout$", false, null),
@@ -460,6 +512,7 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceBridge\.Source\.ACM\.Close$", false, null),
              new Property(@"^IceBridge\.Source\.ACM$", false, null),
+             new Property(@"^IceBridge\.Source\.Acceptors$", false, null),
              new Property(@"^IceBridge\.Source\.AdapterId$", false, null),
              new Property(@"^IceBridge\.Source\.Endpoints$", false, null),
              new Property(@"^IceBridge\.Source\.Locator\.EndpointSelection$", false, null),
@@ -485,13 +538,17 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceBridge\.Source\.Router$", false, null),
              new Property(@"^IceBridge\.Source\.ProxyOptions$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.Size$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceBridge\.Source\.MessageSizeMax$", false, null),
              new Property(@"^IceBridge\.Target\.Endpoints$", false, null),
              new Property(@"^IceBridge\.InstanceName$", false, null),
@@ -512,6 +569,7 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Server\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ACM\.Close$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ACM$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.Acceptors$", false, null),
              new Property(@"^IceGridAdmin\.Server\.AdapterId$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Endpoints$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Locator\.EndpointSelection$", false, null),
@@ -537,13 +595,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Server\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ProxyOptions$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGridAdmin\.Server\.MessageSizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Address$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Interface$", false, null),
@@ -552,6 +614,7 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Acceptors$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdapterId$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.EndpointSelection$", false, null),
@@ -577,18 +640,23 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ProxyOptions$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Acceptors$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdapterId$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.EndpointSelection$", false, null),
@@ -614,13 +682,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ProxyOptions$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.Observers$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.SaveToRegistry$", false, null),
@@ -633,6 +705,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ACM$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Acceptors$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.AdapterId$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Endpoints$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.EndpointSelection$", false, null),
@@ -658,19 +731,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Node\.ACM$", false, null),
+             new Property(@"^IceGrid\.Node\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Node\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Node\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.EndpointSelection$", false, null),
@@ -696,14 +774,19 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Node\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Node\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Node\.AdapterLoadPeriod$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
              new Property(@"^IceGrid\.Node\.CollocateRegistry$", false, null),
@@ -733,6 +816,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper$", false, null),
              new Property(@"^IceGrid\.Node\.WaitTime$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdapterLoadTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminCryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.ConnectionCached$", false, null),
@@ -749,6 +833,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.EndpointSelection$", false, null),
@@ -774,13 +859,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
@@ -796,6 +885,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.EndpointSelection$", false, null),
@@ -821,20 +911,26 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.ChangeLogSize$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.EndpointSelection$", false, null),
@@ -860,13 +956,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Enabled$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Address$", false, null),
@@ -877,6 +977,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.EndpointSelection$", false, null),
@@ -902,17 +1003,22 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.MapSize$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.Path$", false, null),
              new Property(@"^IceGrid\.Registry\.NodeSessionTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.ObserverInitPageSize$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.PreferSecure$", false, null),
@@ -931,6 +1037,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.EndpointSelection$", false, null),
@@ -956,19 +1063,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.EndpointSelection$", false, null),
@@ -994,13 +1106,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ProxyOptions$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Backend$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Size$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
@@ -1037,6 +1153,7 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ACM\.Heartbeat$", false, null),
              new Property(@"^IcePatch2\.ACM\.Close$", false, null),
              new Property(@"^IcePatch2\.ACM$", false, null),
+             new Property(@"^IcePatch2\.Acceptors$", false, null),
              new Property(@"^IcePatch2\.AdapterId$", false, null),
              new Property(@"^IcePatch2\.Endpoints$", false, null),
              new Property(@"^IcePatch2\.Locator\.EndpointSelection$", false, null),
@@ -1062,13 +1179,17 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^IcePatch2\.Router$", false, null),
              new Property(@"^IcePatch2\.ProxyOptions$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Backend$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.Size$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.StackSize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IcePatch2\.MessageSizeMax$", false, null),
              new Property(@"^IcePatch2\.Directory$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
@@ -1119,6 +1240,9 @@ namespace IceInternal
              new Property(@"^IceSSL\.ProtocolVersionMin$", false, null),
              new Property(@"^IceSSL\.Random$", false, null),
              new Property(@"^IceSSL\.SchannelStrongCrypto$", false, null),
+             new Property(@"^IceSSL\.SessionCache\.Size$", false, null),
+             new Property(@"^IceSSL\.SessionCache\.TicketKeyLifetime$", false, null),
+             new Property(@"^IceSSL\.SessionCache\.Timeout$", false, null),
              new Property(@"^IceSSL\.Trace\.Security$", false, null),
              new Property(@"^IceSSL\.TrustOnly$", false, null),
              new Property(@"^IceSSL\.TrustOnly\.Client$", false, null),
@@ -1155,6 +1279,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ACM\.Heartbeat$", false, null),
              new Property(@"^Glacier2\.Client\.ACM\.Close$", false, null),
              new Property(@"^Glacier2\.Client\.ACM$", false, null),
+             new Property(@"^Glacier2\.Client\.Acceptors$", false, null),
              new Property(@"^Glacier2\.Client\.AdapterId$", false, null),
              new Property(@"^Glacier2\.Client\.Endpoints$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.EndpointSelection$", false, null),
@@ -1180,13 +1305,17 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^Glacier2\.Client\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.ProxyOptions$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Backend$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.Size$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.StackSize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^Glacier2\.Client\.MessageSizeMax$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
@@ -1230,6 +1359,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ACM\.Heartbeat$", false, null),
              new Property(@"^Glacier2\.Server\.ACM\.Close$", false, null),
              new Property(@"^Glacier2\.Server\.ACM$", false, null),
+             new Property(@"^Glacier2\.Server\.Acceptors$", false, null),
              new Property(@"^Glacier2\.Server\.AdapterId$", false, null),
              new Property(@"^Glacier2\.Server\.Endpoints$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.EndpointSelection$", false, null),
@@ -1255,13 +1385,17 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Router\.Context\.[^\s]+$", false, null),
              new Property(@"^Glacier2\.Server\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.ProxyOptions$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Backend$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.Size$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.SizeMax$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.SizeWarn$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.NumaNode$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.StackSize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^Glacier2\.Server\.MessageSizeMax$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
@@ -244,6 +244,18 @@ public class MetricsAdminI extends IceMX._MetricsAdminDisp implements Ice.Proper
         return new IceMX.MetricsFailures();
     }
 
+    @Override
+    synchronized public java.util.Map<String, long[]>
+    getMetricsHistograms(String viewName, String mapName, Ice.Current current)
+        throws IceMX.UnknownMetricsView
+    {
+        //
+        // Lifetime histograms are only supported by the C++ metrics maps.
+        //
+        getMetricsView(viewName);
+        return new java.util.HashMap<String, long[]>();
+    }
+
     public <T extends IceMX.Metrics> void
     registerMap(String map, Class<T> cl, Runnable updater)
     {
@@ -251,6 +251,18 @@ public class MetricsAdminI implements com.zeroc.IceMX.MetricsAdmin,
         return new com.zeroc.IceMX.MetricsFailures();
     }
 
+    @Override
+    synchronized public java.util.Map<String, long[]> getMetricsHistograms(String viewName, String mapName,
+                                                                           com.zeroc.Ice.Current current)
+        throws com.zeroc.IceMX.UnknownMetricsView
+    {
+        //
+        // Lifetime histograms are only supported by the C++ metrics maps.
+        //
+        getMetricsView(viewName);
+        return new java.util.HashMap<>();
+    }
+
     public <T extends com.zeroc.IceMX.Metrics> void registerMap(String map, Class<T> cl, Runnable updater)
     {
         boolean updated;
@@ -206,6 +206,12 @@ class ReplicaGroup extends TreeNode
                     AdaptiveLoadBalancingPolicy policy = (AdaptiveLoadBalancingPolicy)_descriptor.loadBalancing;
                     attributes.add(createAttribute("load-sample", policy.loadSample));
                 }
+                else if(_descriptor.loadBalancing instanceof LatencyLoadBalancingPolicy)
+                {
+                    attributes.add(createAttribute("type", "latency"));
+                    LatencyLoadBalancingPolicy policy = (LatencyLoadBalancingPolicy)_descriptor.loadBalancing;
+                    attributes.add(createAttribute("selection", policy.selection));
+                }
                 attributes.add(createAttribute("n-replicas", _descriptor.loadBalancing.nReplicas));
                 writer.writeElement("load-balancing", attributes);
 
@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Thu Jul  2 14:55:02 2020
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 07:26:12 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -33,6 +33,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ACM\.Heartbeat/", false, null),
     new Property("/^Ice\.Admin\.ACM\.Close/", false, null),
     new Property("/^Ice\.Admin\.ACM/", false, null),
+    new Property("/^Ice\.Admin\.Acceptors/", false, null),
     new Property("/^Ice\.Admin\.AdapterId/", false, null),
     new Property("/^Ice\.Admin\.Endpoints/", false, null),
     new Property("/^Ice\.Admin\.Locator\.EndpointSelection/", false, null),
@@ -58,13 +59,17 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Router\.Context\../", false, null),
     new Property("/^Ice\.Admin\.Router/", false, null),
     new Property("/^Ice\.Admin\.ProxyOptions/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.Affinity/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.Backend/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.Size/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.SizeMax/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.SizeWarn/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.NumaNode/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.StackSize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.Serialize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.WorkStealing/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
@@ -77,11 +82,18 @@ PropertyNames.IceProps =
     new Property("/^Ice\.BackgroundLocatorCacheUpdates/", false, null),
     new Property("/^Ice\.BatchAutoFlush/", true, null),
     new Property("/^Ice\.BatchAutoFlushSize/", false, null),
+    new Property("/^Ice\.BufferPool\.MaxBuffers/", false, null),
+    new Property("/^Ice\.BufferPool\.MaxSize/", false, null),
     new Property("/^Ice\.ChangeUser/", false, null),
     new Property("/^Ice\.ClassGraphDepthMax/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
+    new Property("/^Ice\.Compression\.Compressor/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
+    new Property("/^Ice\.Compression\.Threshold/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
+    new Property("/^Ice\.CollocationDirectDispatch/", false, null),
+    new Property("/^Ice\.ConnectRace\.Connectors/", false, null),
+    new Property("/^Ice\.ConnectRace\.Delay/", false, null),
     new Property("/^Ice\.Config/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
@@ -120,10 +132,14 @@ PropertyNames.IceProps =
     new Property("/^Ice\.FactoryAssemblies/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
+    new Property("/^Ice\.HostResolver\.CacheTimeout/", false, null),
+    new Property("/^Ice\.HostResolver\.Threads/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
     new Property("/^Ice\.InitPlugins/", false, null),
     new Property("/^Ice\.IPv4/", false, null),
     new Property("/^Ice\.IPv6/", false, null),
+    new Property("/^Ice\.LocatorCacheJitter/", false, null),
+    new Property("/^Ice\.LocatorCacheRefreshAhead/", false, null),
     new Property("/^Ice\.LogFile/", false, null),
     new Property("/^Ice\.LogFile\.SizeMax/", false, null),
     new Property("/^Ice\.LogStdErr\.Convert/", false, null),
@@ -151,24 +167,34 @@ PropertyNames.IceProps =
     new Property("/^Ice\.StdErr/", false, null),
     new Property("/^Ice\.StdOut/", false, null),
     new Property("/^Ice\.SyslogFacility/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.Affinity/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.Backend/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.SizeWarn/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.NumaNode/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.StackSize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.WorkStealing/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.Affinity/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.Backend/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeWarn/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.NumaNode/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.StackSize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.WorkStealing/", false, null),
     new Property("/^Ice\.ThreadPriority/", false, null),
+    new Property("/^Ice\.TimerTick/", false, null),
     new Property("/^Ice\.ToStringMode/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Properties/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Logger/", false, null),
+    new Property("/^Ice\.Trace\.BufferPool/", false, null),
     new Property("/^Ice\.Trace\.Locator/", false, null),
     new Property("/^Ice\.Trace\.Network/", false, null),
     new Property("/^Ice\.Trace\.Protocol/", false, null),
@@ -18,5 +18,7 @@ if Mapping.getByPath(__name__).hasSource("Ice/exceptions", "serveramd"):
 
 if Mapping.getByPath(__name__).hasSource("Ice/exceptions", "collocated"):
     testcases += [ CollocatedTestCase() ]
+    if isinstance(Mapping.getByPath(__name__), CppMapping):
+        testcases += [ CollocatedTestCase("collocated with direct dispatch", props={ "Ice.CollocationDirectDispatch" : 1 }) ]
 
 TestSuite(__name__, testcases)
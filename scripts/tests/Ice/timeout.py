@@ -10,4 +10,11 @@ traceProps = {
     "Ice.Trace.Protocol" : 1
 }
 
-TestSuite(__name__, [ClientServerTestCase(server=Server(readyCount=2), traceProps=traceProps)], options = { "compress" : [False] }, )
+testcases = [ClientServerTestCase(server=Server(readyCount=2), traceProps=traceProps)]
+
+# The C++ communicator timer can use a timing wheel, see Ice.TimerTick
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    testcases += [ClientServerTestCase("client/server with timing wheel", server=Server(readyCount=2),
+                                       traceProps=traceProps, props={ "Ice.TimerTick" : 1 })]
+
+TestSuite(__name__, testcases, options = { "compress" : [False] }, )
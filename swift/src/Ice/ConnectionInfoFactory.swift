@@ -83,9 +83,10 @@ private class SSLConnectionInfoI: ConnectionInfoI, SSLConnectionInfo {
     var cipher: String
     var certs: [SecCertificate]
     var verified: Bool
+    var resumed: Bool
 
     init(underlying: ConnectionInfo?, incoming: Bool, adapterName: String, connectionId: String,
-         cipher: String, certs: StringSeq, verified: Bool) {
+         cipher: String, certs: StringSeq, verified: Bool, resumed: Bool) {
         self.cipher = cipher
         self.certs = []
         let beginPrefix = "-----BEGIN CERTIFICATE-----\n"
@@ -105,6 +106,7 @@ private class SSLConnectionInfoI: ConnectionInfoI, SSLConnectionInfo {
             }
         }
         self.verified = verified
+        self.resumed = resumed
         super.init(underlying: underlying, incoming: incoming, adapterName: adapterName, connectionId: connectionId)
     }
 }
@@ -213,14 +215,15 @@ class ConnectionInfoFactory: ICEConnectionInfoFactory {
                                         adapterName: String,
                                         connectionId: String,
                                         cipher: String,
-                                        certs: [String], verified: Bool) -> Any {
+                                        certs: [String], verified: Bool, resumed: Bool) -> Any {
         return SSLConnectionInfoI(underlying: getUnderlying(underlying),
                                   incoming: incoming,
                                   adapterName: adapterName,
                                   connectionId: connectionId,
                                   cipher: cipher,
                                   certs: certs,
-                                  verified: verified)
+                                  verified: verified,
+                                  resumed: resumed)
     }
 
     #if os(iOS) || os(watchOS) || os(tvOS)
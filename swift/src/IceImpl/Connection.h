@@ -85,7 +85,8 @@ ICEIMPL_API @protocol ICEConnectionInfoFactory
                  connectionId:(NSString*)connectionId
                        cipher:(NSString*)cipher
                         certs:(NSArray<NSString*>*)certs
-                     verified:(BOOL)verified;
+                     verified:(BOOL)verified
+                      resumed:(BOOL)resumed;
 
 #if TARGET_OS_IPHONE
 
@@ -359,7 +359,8 @@ id createConnectionInfo(std::shared_ptr<Ice::ConnectionInfo> infoPtr)
                                    connectionId:toNSString(sslInfo->connectionId)
                                          cipher:toNSString(sslInfo->cipher)
                                           certs:toNSArray(sslInfo->certs)
-                                       verified:sslInfo->verified];
+                                       verified:sslInfo->verified
+                                        resumed:sslInfo->resumed];
     }
 
 #if TARGET_OS_IPHONE